@@ -4,19 +4,33 @@
 
 
 #include <array>
+#include <cstddef>       // for size_t
+#include <algorithm>     // for none_of()
 #include <system_error>  // for errc
+#include <type_traits>   // for is_void<>, is_same<>, remove_const<>
 
-#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_CPP17_OR_GREATER, gsl_HAVE_EXCEPTIONS, gsl_NODISCARD
+#include <gsl-lite/gsl-lite.hpp>  // for span<>, gsl_Expects(), gsl_ExpectsAudit(), gsl_Assert(), gsl_CPP17_OR_GREATER, gsl_HAVE_EXCEPTIONS, gsl_NODISCARD
 
-#include <slowmath/detail/type_traits.hpp>  // for are_integral_arithmetic_types_v<>, have_same_signedness_v<>
-#include <slowmath/detail/errors.hpp>       // for failfast_error_handler, try_error_handler, throw_error_handler
+#include <slowmath/detail/type_traits.hpp>  // for are_integral_arithmetic_types_v<>, have_same_signedness_v<>, explicit_or_common_integral_value_type<>, common_integral_value_type<>, type_identity_t<>, make_unsigned_t<>, is_signed_v<>
+#include <slowmath/detail/errors.hpp>       // for failfast_error_handler, try_error_handler, checked_error_handler<>, saturate_error_handler, wrapping_result<>, throw_overflow_error(), record_try_result(), checked_result<>(), SLOWMATH_OVERFLOW_TELEMETRY
 
-#include <slowmath/detail/arithmetic.hpp>   // for absi(), negate(), add(), subtract(), multiply(), divide(), modulo()
+#include <slowmath/detail/arithmetic.hpp>   // for absi(), negate(), magnitude(), add_to(), subtract_to(), multiply_to(), multiply_add(), multiply_subtract(), divide(), modulo(), *_wrapping()
+#include <slowmath/detail/compare.hpp>      // for equal(), less()
+#include <slowmath/detail/narrow.hpp>       // for narrow(), narrow_wrapping(), narrow_batch()
 #include <slowmath/detail/bits.hpp>         // for shift_right(), shift_left()
 #include <slowmath/detail/gcd-lcm.hpp>      // for gcd(), lcm()
 #include <slowmath/detail/pow-log.hpp>      // for square(), powi(), log_floori(), log_ceili()
-#include <slowmath/detail/round.hpp>        // for floori(), ceili(), ratio_floori(), ratio_ceili()
+#include <slowmath/detail/round.hpp>        // for floori(), ceili(), ratio_floori(), ratio_ceili(), modulo_euclid(), muldiv_floori(), muldiv_ceili()
 #include <slowmath/detail/factorize.hpp>    // for factorize_floori(), factorize_ceili()
+#include <slowmath/detail/extended.hpp>     // for multiply_extended(), add_with_carry(), subtract_with_borrow()
+#include <slowmath/detail/divider.hpp>      // for make_reciprocal(), divider_access, divmod(), divide(), modulo(), floori(), ceili(), ratio_floori(), ratio_ceili(), modulo_euclid()
+#include <slowmath/detail/constant.hpp>     // for value_or_constant<>, evaluate(), *_op
+#include <slowmath/detail/batch.hpp>        // for transform_batch(), scan_batch(), unary_batch<>, binary_batch<>, scalar_batch<>, *_wrapping_op
+#include <slowmath/detail/reduce.hpp>       // for sum(), product(), dot()
+
+#if SLOWMATH_OVERFLOW_TELEMETRY
+# include <slowmath/detail/telemetry.hpp>  // for source_location, record_try_result(), checked_result<>(), throw_overflow_error()
+#endif // SLOWMATH_OVERFLOW_TELEMETRY
 
 
 namespace slowmath {
@@ -65,6 +79,65 @@ struct factorization<V, E, 2>
 };
 
 
+    // Represents the value hi ∙ 2ᴺ + lo, where N is the number of bits in V.
+template <typename V>
+struct extended_product
+{
+    V hi;
+    detail::make_unsigned_t<V> lo;
+
+        // equivalence
+    gsl_NODISCARD constexpr friend bool operator ==(extended_product const& lhs, extended_product const& rhs) noexcept
+    {
+        return lhs.hi == rhs.hi
+            && lhs.lo == rhs.lo;
+    }
+    gsl_NODISCARD constexpr friend bool operator !=(extended_product const& lhs, extended_product const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+template <typename V>
+struct carry_result
+{
+    V value;
+    bool carry;
+
+        // equivalence
+    gsl_NODISCARD constexpr friend bool operator ==(carry_result const& lhs, carry_result const& rhs) noexcept
+    {
+        return lhs.value == rhs.value
+            && lhs.carry == rhs.carry;
+    }
+    gsl_NODISCARD constexpr friend bool operator !=(carry_result const& lhs, carry_result const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+
+    // The quotient and remainder types differ only if both are `std::integral_constant<>`. The default `R = Q` is declared in
+    // detail/divider.hpp.
+template <typename Q, typename R>
+struct divmod_result
+{
+    Q quotient;
+    R remainder;
+
+        // equivalence
+    gsl_NODISCARD constexpr friend bool operator ==(divmod_result const& lhs, divmod_result const& rhs) noexcept
+    {
+        return lhs.quotient == rhs.quotient
+            && lhs.remainder == rhs.remainder;
+    }
+    gsl_NODISCARD constexpr friend bool operator !=(divmod_result const& lhs, divmod_result const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+
 template <typename T>
 struct arithmetic_result
 {
@@ -74,15 +147,148 @@ struct arithmetic_result
 
 
     //
-    // Computes |v|.
+    // Represents an invariant divisor d ≠ 0 along with its precomputed reciprocal.
+    //ᅟ
+    // The overloads of `divide()`, `modulo()`, `divmod()`, `modulo_euclid()`, `floori()`, `ceili()`, `ratio_floori()`, and
+    // `ratio_ceili()` which take a `divider<>` replace the division instruction with a multiplication and shifts. The divisor is
+    // validated at construction; for signed types, d = -1 is not permitted because n ÷ -1 overflows for n = min_v<V>. The construction
+    // itself is as expensive as a double-width division, so a `divider<>` pays off only if it is used repeatedly.
+    // Enforces preconditions with `gsl_Expects()`.
     //
 template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
+class divider
+{
+    static_assert(detail::are_integral_arithmetic_types_v<V>, "divisor must be an integral type");
+
+    friend detail::divider_access;
+
+private:
+    V divisor_;
+    detail::reciprocal<detail::make_unsigned_t<V>> reciprocal_;
+
+public:
+    constexpr explicit divider(V d)
+        : divisor_(d), reciprocal_{ }
+    {
+        gsl_Expects(d != 0);
+        gsl_Expects(!detail::is_signed_v<V> || d != V(-1));
+
+        reciprocal_ = detail::make_reciprocal(detail::magnitude(d));
+    }
+
+    gsl_NODISCARD constexpr V divisor() const noexcept { return divisor_; }
+};
+
+
+    //
+    // Accumulates the overflow conditions of a sequence of arithmetic operations.
+    //ᅟ
+    // The operations `add()`, `subtract()`, `multiply()`, `negate()`, `absi()`, and `narrow<R>()` return the result modulo 2ᴺ and
+    // record whether it overflowed without branching, which permits the compiler to vectorize loops calling them. Overflow is then
+    // checked once for the entire sequence with `ec()`, `check()`, or `check_failfast()`. If an overflow was recorded, the results
+    // of all operations since the last `reset()` must be considered invalid.
+    // `check()` throws `overflow_error`, and `check_failfast()` uses `gsl_Assert()`.
+    //
+class overflow_accumulator
+{
+private:
+    unsigned overflow_ = 0;
+
+    template <typename V>
+    constexpr V
+    record(detail::wrapping_result<V> result) noexcept
+    {
+        overflow_ |= unsigned(result.overflow);
+        return result.value;
+    }
+
+public:
+    template <typename A, typename B>
+    gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+    add(A a, B b) noexcept
+    {
+        static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+        static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+        return record(detail::add_wrapping(a, b));
+    }
+    template <typename A, typename B>
+    gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+    subtract(A a, B b) noexcept
+    {
+        static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+        static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+        return record(detail::subtract_wrapping(a, b));
+    }
+    template <typename A, typename B>
+    gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+    multiply(A a, B b) noexcept
+    {
+        static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+        static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+        return record(detail::multiply_wrapping(a, b));
+    }
+    template <typename V>
+    gsl_NODISCARD constexpr detail::integral_value_type<V>
+    negate(V v) noexcept
+    {
+        static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+        return record(detail::negate_wrapping(v));
+    }
+    template <typename V>
+    gsl_NODISCARD constexpr detail::integral_value_type<V>
+    absi(V v) noexcept
+    {
+        static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+        return record(detail::absi_wrapping(v));
+    }
+    template <typename R, typename V>
+    gsl_NODISCARD constexpr R
+    narrow(V v) noexcept
+    {
+        static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+        static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+        return record(detail::narrow_wrapping<R>(v));
+    }
+
+    gsl_NODISCARD constexpr bool overflow() const noexcept { return overflow_ != 0; }
+    gsl_NODISCARD constexpr std::errc ec() const noexcept { return overflow_ != 0 ? std::errc::value_too_large : std::errc{ }; }
+
+    void
+    check_failfast() const
+    {
+        gsl_Assert(overflow_ == 0);
+    }
+
+#if gsl_HAVE_EXCEPTIONS
+    void
+    check() const
+    {
+        if (SLOWMATH_DETAIL_UNLIKELY(overflow_ != 0)) detail::throw_overflow_error(arithmetic_operation::unspecified);
+    }
+#endif // gsl_HAVE_EXCEPTIONS
+
+    constexpr void reset() noexcept { overflow_ = 0; }
+};
+
+
+    //
+    // Computes |v|.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename V>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::absi_op, V>
 absi(V v)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
 
-    return detail::absi<detail::ignore_error_handler>(v);
+    return detail::evaluate<EH, detail::absi_op>(v);
 }
 
     //
@@ -91,12 +297,12 @@ absi(V v)
     // Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::absi_op, V>
 absi_failfast(V v)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
 
-    return detail::absi<detail::failfast_error_handler>(v);
+    return detail::evaluate<detail::failfast_error_handler, detail::absi_op>(v);
 }
 
     //
@@ -106,42 +312,119 @@ absi_failfast(V v)
     //
 template <typename V>
 gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<V>>
-try_absi(V v)
+try_absi(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
 
-    return detail::absi<detail::try_error_handler>(v);
+    return detail::record_try_result(detail::absi<detail::try_error_handler>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
     // Computes |v|.
     //ᅟ
-    // Throws `std::system_error` upon overflow.
+    // Throws `overflow_error` upon overflow.
     //
 template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
-absi_checked(V v)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::absi_op, V>
+absi_checked(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
 
-    return detail::absi<detail::throw_error_handler>(v);
+    return detail::checked_result<arithmetic_operation::absi>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::absi>, detail::absi_op>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes |v| for every element v of src and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+absi_failfast(gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::unary_batch<detail::absi_wrapping_op, V>{ src.data() }, dst.data(), dst.size());
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes |v| for every element v of src and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then retain their previous values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_absi(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::unary_batch<detail::absi_wrapping_op, V>{ src.data() }, dst.data(), dst.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes |v| for every element v of src and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+absi_checked(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::unary_batch<detail::absi_wrapping_op, V>{ src.data() }, dst.data(), dst.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::absi SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
 
+    //
+    // Computes -v.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename V>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::negate_op, V>
+negate(V v)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::evaluate<EH, detail::negate_op>(v);
+}
+
     //
     // Computes -v.
     //ᅟ
     // Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::negate_op, V>
 negate_failfast(V v)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
 
-    return detail::negate<detail::failfast_error_handler>(v);
+    return detail::evaluate<detail::failfast_error_handler, detail::negate_op>(v);
 }
 
     //
@@ -151,29 +434,107 @@ negate_failfast(V v)
     //
 template <typename V>
 gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<V>>
-try_negate(V v)
+try_negate(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
 
-    return detail::negate<detail::try_error_handler>(v);
+    return detail::record_try_result(detail::negate<detail::try_error_handler>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
     // Computes -v.
     //ᅟ
-    // Throws `std::system_error` upon overflow.
+    // Throws `overflow_error` upon overflow.
     //
 template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
-negate_checked(V v)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::negate_op, V>
+negate_checked(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
 
-    return detail::negate<detail::throw_error_handler>(v);
+    return detail::checked_result<arithmetic_operation::negate>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::negate>, detail::negate_op>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
+    //
+    // Computes -v for every element v of src and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+negate_failfast(gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::unary_batch<detail::negate_wrapping_op, V>{ src.data() }, dst.data(), dst.size());
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes -v for every element v of src and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then retain their previous values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_negate(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::unary_batch<detail::negate_wrapping_op, V>{ src.data() }, dst.data(), dst.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes -v for every element v of src and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+negate_checked(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::unary_batch<detail::negate_wrapping_op, V>{ src.data() }, dst.data(), dst.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::negate SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a + b.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::add_to_op<void>, A, B>
+add(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::evaluate<EH, detail::add_to_op<void>>(a, b);
+}
 
     //
     // Computes a + b.
@@ -181,13 +542,13 @@ negate_checked(V v)
     // Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::add_to_op<void>, A, B>
 add_failfast(A a, B b)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::add<detail::failfast_error_handler>(a, b);
+    return detail::evaluate<detail::failfast_error_handler, detail::add_to_op<void>>(a, b);
 }
 
     //
@@ -197,45 +558,209 @@ add_failfast(A a, B b)
     //
 template <typename A, typename B>
 gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B>>
-try_add(A a, B b)
+try_add(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::add<detail::try_error_handler>(a, b);
+    return detail::record_try_result(detail::add<detail::try_error_handler>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
     // Computes a + b.
     //ᅟ
-    // Throws `std::system_error` upon overflow.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::add_to_op<void>, A, B>
+add_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::checked_result<arithmetic_operation::add>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::add>, detail::add_to_op<void>>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes a + b.
+    //ᅟ
+    // Saturates to the smallest or largest representable value upon overflow.
     //
 template <typename A, typename B>
 gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
-add_checked(A a, B b)
+add_saturating(A a, B b)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::add<detail::throw_error_handler>(a, b);
+    return detail::add_saturating(a, b);
+}
+
+    //
+    // Computes a + b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename V>
+void
+add_failfast(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::add_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes a + b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then retain their previous values.
+    //
+template <typename A, typename B, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_add(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::add_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a + b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename V>
+void
+add_checked(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::add_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::add SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a + b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename R, typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::add_to_op<R>, A, B>
+add_to(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::evaluate<EH, detail::add_to_op<R>>(a, b);
+}
+
+    //
+    // Computes a + b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::add_to_op<R>, A, B>
+add_to_failfast(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::add_to_op<R>>(a, b);
+}
+
+    //
+    // Computes a + b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr arithmetic_result<R>
+try_add_to(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::record_try_result(detail::add_to<detail::try_error_handler, R>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a + b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::add_to_op<R>, A, B>
+add_to_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::add>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::add>, detail::add_to_op<R>>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
 
+    //
+    // Computes a - b.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::subtract_to_op<void>, A, B>
+subtract(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::evaluate<EH, detail::subtract_to_op<void>>(a, b);
+}
+
     //
     // Computes a - b.
     //ᅟ
     // Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::subtract_to_op<void>, A, B>
 subtract_failfast(A a, B b)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::subtract<detail::failfast_error_handler>(a, b);
+    return detail::evaluate<detail::failfast_error_handler, detail::subtract_to_op<void>>(a, b);
 }
 
     //
@@ -245,612 +770,2546 @@ subtract_failfast(A a, B b)
     //
 template <typename A, typename B>
 gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B>>
-try_subtract(A a, B b)
+try_subtract(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::subtract<detail::try_error_handler>(a, b);
+    return detail::record_try_result(detail::subtract<detail::try_error_handler>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
     // Computes a - b.
     //ᅟ
-    // Throws `std::system_error` upon overflow.
+    // Throws `overflow_error` upon overflow.
     //
 template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
-subtract_checked(A a, B b)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::subtract_to_op<void>, A, B>
+subtract_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::checked_result<arithmetic_operation::subtract>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::subtract>, detail::subtract_to_op<void>>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes a - b.
+    //ᅟ
+    // Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+subtract_saturating(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::subtract_saturating(a, b);
+}
+
+    //
+    // Computes a - b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename V>
+void
+subtract_failfast(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::subtract_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes a - b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then retain their previous values.
+    //
+template <typename A, typename B, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_subtract(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::subtract_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a - b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename V>
+void
+subtract_checked(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::subtract_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::subtract SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a - b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename R, typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::subtract_to_op<R>, A, B>
+subtract_to(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::evaluate<EH, detail::subtract_to_op<R>>(a, b);
+}
+
+    //
+    // Computes a - b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::subtract_to_op<R>, A, B>
+subtract_to_failfast(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::subtract_to_op<R>>(a, b);
+}
+
+    //
+    // Computes a - b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr arithmetic_result<R>
+try_subtract_to(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::record_try_result(detail::subtract_to<detail::try_error_handler, R>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a - b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::subtract_to_op<R>, A, B>
+subtract_to_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::subtract>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::subtract>, detail::subtract_to_op<R>>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::multiply_to_op<void>, A, B>
+multiply(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::evaluate<EH, detail::multiply_to_op<void>>(a, b);
+}
+
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_to_op<void>, A, B>
+multiply_failfast(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::multiply_to_op<void>>(a, b);
+}
+
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B>>
+try_multiply(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::record_try_result(detail::multiply<detail::try_error_handler>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_to_op<void>, A, B>
+multiply_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::checked_result<arithmetic_operation::multiply>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::multiply>, detail::multiply_to_op<void>>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+multiply_saturating(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::multiply_saturating(a, b);
+}
+
+    //
+    // Computes a ∙ b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename V>
+void
+multiply_failfast(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::multiply_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes a ∙ b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then retain their previous values.
+    //
+template <typename A, typename B, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_multiply(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::multiply_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename V>
+void
+multiply_checked(gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::transform_batch(detail::binary_batch<detail::multiply_wrapping_op, A, B>{ a.data(), b.data() }, dst.data(), dst.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::multiply SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a ∙ b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename R, typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::multiply_to_op<R>, A, B>
+multiply_to(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::evaluate<EH, detail::multiply_to_op<R>>(a, b);
+}
+
+    //
+    // Computes a ∙ b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_to_op<R>, A, B>
+multiply_to_failfast(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::multiply_to_op<R>>(a, b);
+}
+
+    //
+    // Computes a ∙ b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr arithmetic_result<R>
+try_multiply_to(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::record_try_result(detail::multiply_to<detail::try_error_handler, R>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b and checks that the result is representable by `R`.
+    //ᅟ
+    // The arguments may have different signedness.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename R, typename A, typename B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_to_op<R>, A, B>
+multiply_to_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::multiply>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::multiply>, detail::multiply_to_op<R>>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a ∙ b + c.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename A, typename B, typename C>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::multiply_add_op, A, B, C>
+multiply_add(A a, B b, C c)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::evaluate<EH, detail::multiply_add_op>(a, b, c);
+}
+
+    //
+    // Computes a ∙ b + c.
+    //ᅟ
+    // Only the final result is checked for overflow; an intermediate product that is not representable is not an error.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename C>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_add_op, A, B, C>
+multiply_add_failfast(A a, B b, C c)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::multiply_add_op>(a, b, c);
+}
+
+    //
+    // Computes a ∙ b + c.
+    //ᅟ
+    // Only the final result is checked for overflow; an intermediate product that is not representable is not an error.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename A, typename B, typename C>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B, C>>
+try_multiply_add(A a, B b, C c SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::record_try_result(detail::multiply_add<detail::try_error_handler>(a, b, c) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b + c.
+    //ᅟ
+    // Only the final result is checked for overflow; an intermediate product that is not representable is not an error.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename C>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_add_op, A, B, C>
+multiply_add_checked(A a, B b, C c SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::checked_result<arithmetic_operation::multiply_add>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::multiply_add>, detail::multiply_add_op>(a, b, c) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a ∙ b - c.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename A, typename B, typename C>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::multiply_subtract_op, A, B, C>
+multiply_subtract(A a, B b, C c)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::evaluate<EH, detail::multiply_subtract_op>(a, b, c);
+}
+
+    //
+    // Computes a ∙ b - c.
+    //ᅟ
+    // Only the final result is checked for overflow; an intermediate product that is not representable is not an error.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename C>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_subtract_op, A, B, C>
+multiply_subtract_failfast(A a, B b, C c)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::multiply_subtract_op>(a, b, c);
+}
+
+    //
+    // Computes a ∙ b - c.
+    //ᅟ
+    // Only the final result is checked for overflow; an intermediate product that is not representable is not an error.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename A, typename B, typename C>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B, C>>
+try_multiply_subtract(A a, B b, C c SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::record_try_result(detail::multiply_subtract<detail::try_error_handler>(a, b, c) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b - c.
+    //ᅟ
+    // Only the final result is checked for overflow; an intermediate product that is not representable is not an error.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename C>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::multiply_subtract_op, A, B, C>
+multiply_subtract_checked(A a, B b, C c SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, C>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, C>, "argument types must have identical signedness");
+
+    return detail::checked_result<arithmetic_operation::multiply_subtract>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::multiply_subtract>, detail::multiply_subtract_op>(a, b, c) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes the full-width product a ∙ b = hi ∙ 2ᴺ + lo, where N is the number of bits in the common type of a and b.
+    //ᅟ
+    // The product is always representable, so no overflow check is required. 64-bit and 128-bit operands are supported.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr extended_product<detail::common_integral_value_type<A, B>>
+multiply_extended(A a, B b)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+
+    return detail::multiply_extended(a, b);
+}
+
+    //
+    // Computes a + b + carryIn for unsigned a, b modulo 2ᴺ, where N is the number of bits in the common type of a and b, and
+    // returns the sum along with the carry.
+    //ᅟ
+    // Calls can be chained to add multi-word integers.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr carry_result<detail::common_integral_value_type<A, B>>
+add_with_carry(A a, B b, bool carryIn = false)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(!detail::is_signed_v<detail::common_integral_value_type<A, B>> && detail::have_same_signedness_v<A, B>, "argument types must be unsigned");
+
+    using U = detail::common_integral_value_type<A, B>;
+    return detail::add_with_carry(U(a), U(b), carryIn);
+}
+
+    //
+    // Computes a - b - borrowIn for unsigned a, b modulo 2ᴺ, where N is the number of bits in the common type of a and b, and
+    // returns the difference along with the borrow.
+    //ᅟ
+    // Calls can be chained to subtract multi-word integers.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr carry_result<detail::common_integral_value_type<A, B>>
+subtract_with_borrow(A a, B b, bool borrowIn = false)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(!detail::is_signed_v<detail::common_integral_value_type<A, B>> && detail::have_same_signedness_v<A, B>, "argument types must be unsigned");
+
+    using U = detail::common_integral_value_type<A, B>;
+    return detail::subtract_with_borrow(U(a), U(b), borrowIn);
+}
+
+
+    //
+    // Computes n ÷ d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename N, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::divide_op, N, D>
+divide(N n, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::evaluate<EH, detail::divide_op>(n, d);
+}
+
+    //
+    // Computes n ÷ d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::divide_op, N, D>
+divide_failfast(N n, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::divide_op>(n, d);
+}
+
+    //
+    // Computes n ÷ d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<N, D>>
+try_divide(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::record_try_result(detail::divide<detail::try_error_handler>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes n ÷ d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::divide_op, N, D>
+divide_checked(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::checked_result<arithmetic_operation::divide>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::divide>, detail::divide_op>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename N, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::modulo_op, N, D>
+modulo(N n, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::evaluate<EH, detail::modulo_op>(n, d);
+}
+
+    //
+    // Computes n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::modulo_op, N, D>
+modulo_failfast(N n, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::modulo_op>(n, d);
+}
+
+    //
+    // Computes n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<N, D>>
+try_modulo(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::record_try_result(detail::modulo<detail::try_error_handler>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::modulo_op, N, D>
+modulo_checked(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::checked_result<arithmetic_operation::modulo>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::modulo>, detail::modulo_op>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes n ÷ d and n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename N, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::divmod_op, N, D>
+divmod(N n, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::evaluate<EH, detail::divmod_op>(n, d);
+}
+
+    //
+    // Computes n ÷ d and n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::divmod_op, N, D>
+divmod_failfast(N n, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::divmod_op>(n, d);
+}
+
+    //
+    // Computes n ÷ d and n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr arithmetic_result<divmod_result<detail::common_integral_value_type<N, D>>>
+try_divmod(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::record_try_result(detail::divmod<detail::try_error_handler>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes n ÷ d and n mod d for d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename N, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::divmod_op, N, D>
+divmod_checked(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d != 0);
+
+    return detail::checked_result<arithmetic_operation::divide>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::divide>, detail::divmod_op>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes n ÷ d.
+    //ᅟ
+    // Uses the precomputed reciprocal of d.
+    //
+template <typename N, typename V>
+gsl_NODISCARD constexpr V
+divide(N n, divider<V> const& d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
+
+    return detail::divide(V(n), d);
+}
+
+    //
+    // Computes n mod d.
+    //ᅟ
+    // Uses the precomputed reciprocal of d.
+    //
+template <typename N, typename V>
+gsl_NODISCARD constexpr V
+modulo(N n, divider<V> const& d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
+
+    return detail::modulo(V(n), d);
+}
+
+    //
+    // Computes n ÷ d and n mod d.
+    //ᅟ
+    // Uses the precomputed reciprocal of d.
+    //
+template <typename N, typename V>
+gsl_NODISCARD constexpr divmod_result<V>
+divmod(N n, divider<V> const& d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
+
+    return detail::divmod(V(n), d);
+}
+
+    //
+    // Computes n ÷ d and n mod d.
+    //ᅟ
+    // Uses the precomputed reciprocal of d.
+    // The divisor cannot be -1, so no overflow can occur; this overload exists for symmetry with `divmod_failfast(n, d)`.
+    //
+template <typename N, typename V>
+gsl_NODISCARD constexpr divmod_result<V>
+divmod_failfast(N n, divider<V> const& d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
+
+    return detail::divmod(V(n), d);
+}
+
+    //
+    // Computes n ÷ d and n mod d.
+    //ᅟ
+    // Uses the precomputed reciprocal of d.
+    // The divisor cannot be -1, so no overflow can occur; this overload exists for symmetry with `try_divmod(n, d)`.
+    //
+template <typename N, typename V>
+gsl_NODISCARD constexpr arithmetic_result<divmod_result<V>>
+try_divmod(N n, divider<V> const& d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
+
+    return { detail::divmod(V(n), d), std::errc{ } };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes n ÷ d and n mod d.
+    //ᅟ
+    // Uses the precomputed reciprocal of d.
+    // The divisor cannot be -1, so no overflow can occur; this overload exists for symmetry with `divmod_checked(n, d)`.
+    //
+template <typename N, typename V>
+gsl_NODISCARD constexpr divmod_result<V>
+divmod_checked(N n, divider<V> const& d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
+
+    return detail::divmod(V(n), d);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Determines whether a = b.
+    //ᅟ
+    // Unlike the built-in comparison operators, compares the mathematical values of arguments of different signedness.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr bool
+cmp_equal(A a, B b) noexcept
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return detail::equal(a, b);
+}
+
+    //
+    // Determines whether a ≠ b.
+    //ᅟ
+    // Unlike the built-in comparison operators, compares the mathematical values of arguments of different signedness.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr bool
+cmp_not_equal(A a, B b) noexcept
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return !detail::equal(a, b);
+}
+
+    //
+    // Determines whether a < b.
+    //ᅟ
+    // Unlike the built-in comparison operators, compares the mathematical values of arguments of different signedness.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr bool
+cmp_less(A a, B b) noexcept
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return detail::less(a, b);
+}
+
+    //
+    // Determines whether a > b.
+    //ᅟ
+    // Unlike the built-in comparison operators, compares the mathematical values of arguments of different signedness.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr bool
+cmp_greater(A a, B b) noexcept
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return detail::less(b, a);
+}
+
+    //
+    // Determines whether a ≤ b.
+    //ᅟ
+    // Unlike the built-in comparison operators, compares the mathematical values of arguments of different signedness.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr bool
+cmp_less_equal(A a, B b) noexcept
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return !detail::less(b, a);
+}
+
+    //
+    // Determines whether a ≥ b.
+    //ᅟ
+    // Unlike the built-in comparison operators, compares the mathematical values of arguments of different signedness.
+    //
+template <typename A, typename B>
+gsl_NODISCARD constexpr bool
+cmp_greater_equal(A a, B b) noexcept
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return !detail::less(a, b);
+}
+
+
+    //
+    // Converts v to type `R`.
+    //ᅟ
+    // The argument may have different signedness than `R`.
+    // Handles values not representable by `R` with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename R, typename EH = default_error_handler, typename V>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::narrow_op<R>, V>
+narrow(V v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::evaluate<EH, detail::narrow_op<R>>(v);
+}
+
+    //
+    // Converts v to type `R`.
+    //ᅟ
+    // The argument may have different signedness than `R`.
+    // Uses `gsl_Assert()` to check that v is representable by `R`.
+    //
+template <typename R, typename V>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::narrow_op<R>, V>
+narrow_failfast(V v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::narrow_op<R>>(v);
+}
+
+    //
+    // Converts v to type `R`.
+    //ᅟ
+    // The argument may have different signedness than `R`.
+    // Returns error code `std::errc::value_too_large` if v is not representable by `R`.
+    //
+template <typename R, typename V>
+gsl_NODISCARD constexpr arithmetic_result<R>
+try_narrow(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::record_try_result(detail::narrow<detail::try_error_handler, R>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Converts v to type `R`.
+    //ᅟ
+    // The argument may have different signedness than `R`.
+    // Throws `overflow_error` if v is not representable by `R`.
+    //
+template <typename R, typename V>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::narrow_op<R>, V>
+narrow_checked(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::checked_result<arithmetic_operation::narrow>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::narrow>, detail::narrow_op<R>>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Converts v to type `R`.
+    //ᅟ
+    // The argument may have different signedness than `R`.
+    // Saturates to the smallest or largest value representable by `R` if v is not representable by `R`.
+    //
+template <typename R, typename V>
+gsl_NODISCARD constexpr R
+narrow_saturating(V v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<R>, "result type must be an integral type");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::narrow<detail::saturate_error_handler, R>(v);
+}
+
+    //
+    // Converts the elements of src to type `R` and stores them in dst.
+    //ᅟ
+    // The range check is vectorized for blocks of elements.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that all elements are representable by `R`.
+    //
+template <typename V, typename R>
+void
+narrow_failfast(gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::narrow_batch(src.data(), dst.data(), src.size());
+    gsl_Assert(n == src.size());
+}
+
+    //
+    // Converts the elements of src to type `R` and stores them in dst.
+    //ᅟ
+    // The range check is vectorized for blocks of elements.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements converted. If an element is not representable
+    // by `R`, returns its index along with error code `std::errc::value_too_large`; the elements of dst from that index on then
+    // have unspecified values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_narrow(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::narrow_batch(src.data(), dst.data(), src.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == src.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Converts the elements of src to type `R` and stores them in dst.
+    //ᅟ
+    // The range check is vectorized for blocks of elements.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` if an element is not representable by `R`.
+    //
+template <typename V, typename R>
+void
+narrow_checked(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::narrow_batch(src.data(), dst.data(), src.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != src.size())) detail::throw_overflow_error(arithmetic_operation::narrow SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename V>
+gsl_NODISCARD detail::result_t<EH, std::remove_const_t<V>>
+sum(gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::sum<EH>(v.data(), v.size());
+}
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+sum_failfast(gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::sum<detail::failfast_error_handler>(v.data(), v.size());
+}
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD arithmetic_result<std::remove_const_t<V>>
+try_sum(gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::record_try_result(detail::sum<detail::try_error_handler>(v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+sum_checked(gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::sum>(
+        detail::sum<detail::checked_error_handler<arithmetic_operation::sum>>(v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+sum_saturating(gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::sum<detail::saturate_error_handler>(v.data(), v.size());
+}
+
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename V>
+gsl_NODISCARD detail::result_t<EH, std::remove_const_t<V>>
+product(gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::product<EH>(v.data(), v.size());
+}
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+product_failfast(gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::product<detail::failfast_error_handler>(v.data(), v.size());
+}
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD arithmetic_result<std::remove_const_t<V>>
+try_product(gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::record_try_result(detail::product<detail::try_error_handler>(v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+product_checked(gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::product>(
+        detail::product<detail::checked_error_handler<arithmetic_operation::product>>(v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+product_saturating(gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::product<detail::saturate_error_handler>(v.data(), v.size());
+}
+
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD detail::result_t<EH, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>
+dot(gsl::span<A> a, gsl::span<B> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::dot<EH, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(a.data(), b.data(), a.size());
+}
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B>
+gsl_NODISCARD detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>
+dot_failfast(gsl::span<A> a, gsl::span<B> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::dot<detail::failfast_error_handler, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(a.data(), b.data(), a.size());
+}
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD arithmetic_result<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>
+try_dot(gsl::span<A> a, gsl::span<B> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::record_try_result(detail::dot<detail::try_error_handler, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(a.data(), b.data(), a.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>
+dot_checked(gsl::span<A> a, gsl::span<B> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::checked_result<arithmetic_operation::dot>(
+        detail::dot<detail::checked_error_handler<arithmetic_operation::dot>, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(a.data(), b.data(), a.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span.
+    // Enforces preconditions with `gsl_Expects()`. Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>
+dot_saturating(gsl::span<A> a, gsl::span<B> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::dot<detail::saturate_error_handler, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(a.data(), b.data(), a.size());
+}
+
+
+    //
+    // Computes the running sums init, init + src[0], …, init + src[0] + … + src[n - 2] and stores them in dst.
+    //ᅟ
+    // The overflow check is done for blocks of elements. dst may alias src. The sum of all elements is not computed.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+exclusive_scan_failfast(gsl::span<V> src, gsl::span<R> dst, detail::type_identity_t<R> init = 0)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::scan_batch<false>(src.data(), dst.data(), dst.size(), init);
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes the running sums init, init + src[0], …, init + src[0] + … + src[n - 2] and stores them in dst.
+    //ᅟ
+    // The overflow check is done for blocks of elements. dst may alias src. The sum of all elements is not computed.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first element whose running sum is not representable along with error code `std::errc::value_too_large`;
+    // the elements of dst from that index on then retain their previous values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_exclusive_scan(gsl::span<V> src, gsl::span<R> dst, detail::type_identity_t<R> init = 0 SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::scan_batch<false>(src.data(), dst.data(), dst.size(), init);
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the running sums init, init + src[0], …, init + src[0] + … + src[n - 2] and stores them in dst.
+    //ᅟ
+    // The overflow check is done for blocks of elements. dst may alias src. The sum of all elements is not computed.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+exclusive_scan_checked(gsl::span<V> src, gsl::span<R> dst, detail::type_identity_t<R> init = 0 SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::scan_batch<false>(src.data(), dst.data(), dst.size(), init);
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::exclusive_scan SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes the running sums src[0], src[0] + src[1], …, src[0] + … + src[n - 1] and stores them in dst.
+    //ᅟ
+    // The overflow check is done for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+inclusive_scan_failfast(gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::scan_batch<true>(src.data(), dst.data(), dst.size(), R(0));
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes the running sums src[0], src[0] + src[1], …, src[0] + … + src[n - 1] and stores them in dst.
+    //ᅟ
+    // The overflow check is done for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first element whose running sum is not representable along with error code `std::errc::value_too_large`;
+    // the elements of dst from that index on then retain their previous values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_inclusive_scan(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::scan_batch<true>(src.data(), dst.data(), dst.size(), R(0));
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the running sums src[0], src[0] + src[1], …, src[0] + … + src[n - 1] and stores them in dst.
+    //ᅟ
+    // The overflow check is done for blocks of elements. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+inclusive_scan_checked(gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::scan_batch<true>(src.data(), dst.data(), dst.size(), R(0));
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::inclusive_scan SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename V>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::square_op, V>
+square(V v)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return detail::evaluate<EH, detail::square_op>(v);
+}
+
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::square_op, V>
+square_failfast(V v)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    return detail::evaluate<detail::failfast_error_handler, detail::square_op>(v);
+}
+
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<V>>
+try_square(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::record_try_result(detail::square<detail::try_error_handler>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b.
+    //ᅟ
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::square_op, V>
+square_checked(V v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+
+    return detail::checked_result<arithmetic_operation::square>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::square>, detail::square_op>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename X, typename S>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::shift_left_op, X, S>
+shift_left(X x, S s)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::evaluate<EH, detail::shift_left_op>(x, s);
+}
+
+    //
+    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename X, typename S>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::shift_left_op, X, S>
+shift_left_failfast(X x, S s)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::shift_left_op>(x, s);
+}
+
+    //
+    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename X, typename S>
+gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<X>>
+try_shift_left(X x, S s SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::record_try_result(detail::shift_left<detail::try_error_handler>(x, s) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename X, typename S>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::shift_left_op, X, S>
+shift_left_checked(X x, S s SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::checked_result<arithmetic_operation::shift_left>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::shift_left>, detail::shift_left_op>(x, s) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Saturates to the largest representable value upon overflow.
+    //
+template <typename X, typename S>
+gsl_NODISCARD constexpr detail::integral_value_type<X>
+shift_left_saturating(X x, S s)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::shift_left<detail::saturate_error_handler>(x, s);
+}
+
+    //
+    // Computes x ∙ 2ˢ for every element x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits) and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename X, typename S, typename V>
+void
+shift_left_failfast(gsl::span<X> x, S s, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<S>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(std::is_same<std::remove_const_t<X>, V>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(s >= 0);
+    gsl_ExpectsAudit(std::none_of(x.begin(), x.end(), [](std::remove_const_t<X> v) { return v < 0; }));
+
+    std::size_t n = detail::transform_batch(detail::scalar_batch<detail::shift_left_wrapping_op, X, S>{ x.data(), s }, dst.data(), dst.size());
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes x ∙ 2ˢ for every element x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits) and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then retain their previous values.
+    //
+template <typename X, typename S, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_shift_left(gsl::span<X> x, S s, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<S>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(std::is_same<std::remove_const_t<X>, V>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(s >= 0);
+    gsl_ExpectsAudit(std::none_of(x.begin(), x.end(), [](std::remove_const_t<X> v) { return v < 0; }));
+
+    std::size_t n = detail::transform_batch(detail::scalar_batch<detail::shift_left_wrapping_op, X, S>{ x.data(), s }, dst.data(), dst.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes x ∙ 2ˢ for every element x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits) and stores the results in dst.
+    //ᅟ
+    // The overflow check is vectorized for blocks of elements. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename X, typename S, typename V>
+void
+shift_left_checked(gsl::span<X> x, S s, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<S>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(std::is_same<std::remove_const_t<X>, V>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(s >= 0);
+    gsl_ExpectsAudit(std::none_of(x.begin(), x.end(), [](std::remove_const_t<X> v) { return v < 0; }));
+
+    std::size_t n = detail::transform_batch(detail::scalar_batch<detail::shift_left_wrapping_op, X, S>{ x.data(), s }, dst.data(), dst.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::shift_left SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename X, typename S>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::shift_right_op, X, S>
+shift_right(X x, S s)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::evaluate<EH, detail::shift_right_op>(x, s);
+}
+
+    //
+    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename X, typename S>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::shift_right_op, X, S>
+shift_right_failfast(X x, S s)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::shift_right_op>(x, s);
+}
+
+    //
+    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename X, typename S>
+gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<X>>
+try_shift_right(X x, S s SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::record_try_result(detail::shift_right<detail::try_error_handler>(x, s) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename X, typename S>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::shift_right_op, X, S>
+shift_right_checked(X x, S s SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(x >= 0 && s >= 0);
+
+    return detail::checked_result<arithmetic_operation::shift_right>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::shift_right>, detail::shift_right_op>(x, s) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes bᵉ for e ∊ ℕ₀.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename B, typename E>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::powi_op, B, E>
+powi(B b, E e)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(e >= 0);
+
+    return detail::evaluate<EH, detail::powi_op>(b, e);
+}
+
+    //
+    // Computes bᵉ for e ∊ ℕ₀.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename B, typename E>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::powi_op, B, E>
+powi_failfast(B b, E e)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(e >= 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::powi_op>(b, e);
+}
+
+    //
+    // Computes bᵉ for e ∊ ℕ₀.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename B, typename E>
+gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<B>>
+try_powi(B b, E e SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(e >= 0);
+
+    return detail::record_try_result(detail::powi<detail::try_error_handler>(b, e) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes bᵉ for e ∊ ℕ₀.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename B, typename E>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::powi_op, B, E>
+powi_checked(B b, E e SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(e >= 0);
+
+    return detail::checked_result<arithmetic_operation::powi>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::powi>, detail::powi_op>(b, e) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes bᵉ for e ∊ ℕ₀.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename B, typename E>
+gsl_NODISCARD constexpr detail::integral_value_type<B>
+powi_saturating(B b, E e)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+
+    gsl_Expects(e >= 0);
+
+    return detail::powi<detail::saturate_error_handler>(b, e);
+}
+
+
+    //
+    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename X, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::floori_op, X, D>
+floori(X x, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::evaluate<EH, detail::floori_op>(x, d);
+}
+
+    //
+    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::floori_op, X, D>
+floori_failfast(X x, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::floori_op>(x, d);
+}
+
+    //
+    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<X, D>>
+try_floori(X x, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::record_try_result(detail::floori<detail::try_error_handler>(x, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::floori_op, X, D>
+floori_checked(X x, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::checked_result<arithmetic_operation::floori>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::floori>, detail::floori_op>(x, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Saturates to the smallest representable value upon overflow.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr detail::common_integral_value_type<X, D>
+floori_saturating(X x, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::floori<detail::saturate_error_handler>(x, d);
+}
+
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename X, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::ceili_op, X, D>
+ceili(X x, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::evaluate<EH, detail::ceili_op>(x, d);
+}
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::ceili_op, X, D>
+ceili_failfast(X x, D d)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::evaluate<detail::failfast_error_handler, detail::ceili_op>(x, d);
+}
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<X, D>>
+try_ceili(X x, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::record_try_result(detail::ceili<detail::try_error_handler>(x, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::ceili_op, X, D>
+ceili_checked(X x, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+
+    gsl_Expects(d > 0);
+
+    return detail::checked_result<arithmetic_operation::ceili>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::ceili>, detail::ceili_op>(x, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Saturates to the largest representable value upon overflow.
+    //
+template <typename X, typename D>
+gsl_NODISCARD constexpr detail::common_integral_value_type<X, D>
+ceili_saturating(X x, D d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
 
-    return detail::subtract<detail::throw_error_handler>(a, b);
-}
-#endif // gsl_HAVE_EXCEPTIONS
+    gsl_Expects(d > 0);
 
+    return detail::ceili<detail::saturate_error_handler>(x, d);
+}
 
     //
-    // Computes a ∙ b.
+    // Computes ⌈x ÷ d⌉ ∙ d for every element x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, and stores the results in dst.
     //ᅟ
-    // Uses `gsl_Assert()` to check that no overflow occurs.
+    // The overflow check is vectorized for blocks of elements. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
     //
-template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
-multiply_failfast(A a, B b)
+template <typename X, typename D, typename V>
+void
+ceili_failfast(gsl::span<X> x, D d, gsl::span<V> dst)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<D>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<X>, D>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<X>, D>, V>::value, "destination element type must be the common type of the argument types");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(d > 0);
 
-    return detail::multiply<detail::failfast_error_handler>(a, b);
+    std::size_t n = detail::transform_batch(detail::scalar_batch<detail::ceili_wrapping_op, X, D>{ x.data(), d }, dst.data(), dst.size());
+    gsl_Assert(n == dst.size());
 }
 
     //
-    // Computes a ∙ b.
+    // Computes ⌈x ÷ d⌉ ∙ d for every element x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, and stores the results in dst.
     //ᅟ
-    // Returns error code `std::errc::value_too_large` upon overflow.
+    // The overflow check is vectorized for blocks of elements. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then retain their previous values.
     //
-template <typename A, typename B>
-gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B>>
-try_multiply(A a, B b)
+template <typename X, typename D, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_ceili(gsl::span<X> x, D d, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<D>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<X>, D>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<X>, D>, V>::value, "destination element type must be the common type of the argument types");
 
-    return detail::multiply<detail::try_error_handler>(a, b);
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(d > 0);
+
+    std::size_t n = detail::transform_batch(detail::scalar_batch<detail::ceili_wrapping_op, X, D>{ x.data(), d }, dst.data(), dst.size());
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
-    // Computes a ∙ b.
+    // Computes ⌈x ÷ d⌉ ∙ d for every element x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, and stores the results in dst.
     //ᅟ
-    // Throws `std::system_error` upon overflow.
+    // The overflow check is vectorized for blocks of elements. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
     //
-template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
-multiply_checked(A a, B b)
+template <typename X, typename D, typename V>
+void
+ceili_checked(gsl::span<X> x, D d, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<D>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<X>, D>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<X>, D>, V>::value, "destination element type must be the common type of the argument types");
 
-    return detail::multiply<detail::throw_error_handler>(a, b);
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(d > 0);
+
+    std::size_t n = detail::transform_batch(detail::scalar_batch<detail::ceili_wrapping_op, X, D>{ x.data(), d }, dst.data(), dst.size());
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::ceili SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
 
     //
-    // Computes n ÷ d for d ≠ 0.
+    // Computes ⌊n ÷ d⌋ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
     // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
     //
-template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-divide(N n, D d)
+template <typename EH = default_error_handler, typename N, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::ratio_floori_op, N, D>
+ratio_floori(N n, D d)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::divide<detail::ignore_error_handler>(n, d);
+    return detail::evaluate<EH, detail::ratio_floori_op>(n, d);
 }
 
     //
-    // Computes n ÷ d for d ≠ 0.
+    // Computes ⌊n ÷ d⌋ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
     // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-divide_failfast(N n, D d)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::ratio_floori_op, N, D>
+ratio_floori_failfast(N n, D d)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::divide<detail::failfast_error_handler>(n, d);
+    return detail::evaluate<detail::failfast_error_handler, detail::ratio_floori_op>(n, d);
 }
 
     //
-    // Computes n ÷ d for d ≠ 0.
+    // Computes ⌊n ÷ d⌋ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
     // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
     //
 template <typename N, typename D>
 gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<N, D>>
-try_divide(N n, D d)
+try_ratio_floori(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::divide<detail::try_error_handler>(n, d);
+    return detail::record_try_result(detail::ratio_floori<detail::try_error_handler>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
-    // Computes n ÷ d for d ≠ 0.
+    // Computes ⌊n ÷ d⌋ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
     //
 template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-divide_checked(N n, D d)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::ratio_floori_op, N, D>
+ratio_floori_checked(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::divide<detail::throw_error_handler>(n, d);
+    return detail::checked_result<arithmetic_operation::ratio_floori>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::ratio_floori>, detail::ratio_floori_op>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
 
     //
-    // Computes n mod d for d ≠ 0.
+    // Computes ⌈n ÷ d⌉ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
     // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
     //
-template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-modulo(N n, D d)
+template <typename EH = default_error_handler, typename N, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::ratio_ceili_op, N, D>
+ratio_ceili(N n, D d)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::modulo<detail::ignore_error_handler>(n, d);
+    return detail::evaluate<EH, detail::ratio_ceili_op>(n, d);
 }
 
     //
-    // Computes n mod d for d ≠ 0.
+    // Computes ⌈n ÷ d⌉ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
     // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-modulo_failfast(N n, D d)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::ratio_ceili_op, N, D>
+ratio_ceili_failfast(N n, D d)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::modulo<detail::failfast_error_handler>(n, d);
+    return detail::evaluate<detail::failfast_error_handler, detail::ratio_ceili_op>(n, d);
 }
 
     //
-    // Computes n mod d for d ≠ 0.
+    // Computes ⌈n ÷ d⌉ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
     // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
     //
 template <typename N, typename D>
 gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<N, D>>
-try_modulo(N n, D d)
+try_ratio_ceili(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::modulo<detail::try_error_handler>(n, d);
+    return detail::record_try_result(detail::ratio_ceili<detail::try_error_handler>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
-    // Computes n mod d for d ≠ 0.
+    // Computes ⌈n ÷ d⌉ for n, d ∊ ℤ, d ≠ 0.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
     //
 template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-modulo_checked(N n, D d)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::ratio_ceili_op, N, D>
+ratio_ceili_checked(N n, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
     gsl_Expects(d != 0);
 
-    return detail::modulo<detail::throw_error_handler>(n, d);
-}
-#endif // gsl_HAVE_EXCEPTIONS
-
-
-    //
-    // Computes a ∙ b.
-    //
-template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
-square(V v)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "arguments must be integral types or std::integral_constant<> of integral types");
-
-    return detail::square<detail::ignore_error_handler>(v);
-}
-
-    //
-    // Computes a ∙ b.
-    //ᅟ
-    // Uses `gsl_Assert()` to check that no overflow occurs.
-    //
-template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
-square_failfast(V v)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "arguments must be integral types or std::integral_constant<> of integral types");
-
-    return detail::square<detail::failfast_error_handler>(v);
-}
-
-    //
-    // Computes a ∙ b.
-    //ᅟ
-    // Returns error code `std::errc::value_too_large` upon overflow.
-    //
-template <typename V>
-gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<V>>
-try_square(V v)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
-
-    return detail::square<detail::try_error_handler>(v);
-}
-
-#if gsl_HAVE_EXCEPTIONS
-    //
-    // Computes a ∙ b.
-    //ᅟ
-    // Throws `std::system_error` upon overflow.
-    //
-template <typename V>
-gsl_NODISCARD constexpr detail::integral_value_type<V>
-square_checked(V v)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<V>, "argument must be an integral type or an std::integral_constant<> of an integral type");
-
-    return detail::square<detail::throw_error_handler>(v);
+    return detail::checked_result<arithmetic_operation::ratio_ceili>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::ratio_ceili>, detail::ratio_ceili_op>(n, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
 
     //
-    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
+    // Computes n mod d for n, d ∊ ℤ, d ≠ 0, such that 0 ≤ n mod d < |d|.
     //ᅟ
+    // Unlike `modulo()`, which truncates like the built-in `%` operator, the result is never negative. Cannot overflow.
     // Enforces preconditions with `gsl_Expects()`.
     //
-template <typename X, typename S>
-gsl_NODISCARD constexpr detail::integral_value_type<X>
-shift_left(X x, S s)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
-
-    gsl_Expects(x >= 0 && s >= 0);
-
-    return detail::shift_left<detail::ignore_error_handler>(x, s);
-}
-
-    //
-    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
-    //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
-    //
-template <typename X, typename S>
-gsl_NODISCARD constexpr detail::integral_value_type<X>
-shift_left_failfast(X x, S s)
+template <typename N, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::modulo_euclid_op, N, D>
+modulo_euclid(N n, D d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
 
-    gsl_Expects(x >= 0 && s >= 0);
+    gsl_Expects(d != 0);
 
-    return detail::shift_left<detail::failfast_error_handler>(x, s);
+    return detail::evaluate<detail::ignore_error_handler, detail::modulo_euclid_op>(n, d);
 }
 
-    //
-    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
-    //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
-    //
-template <typename X, typename S>
-gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<X>>
-try_shift_left(X x, S s)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
-
-    gsl_Expects(x >= 0 && s >= 0);
-
-    return detail::shift_left<detail::try_error_handler>(x, s);
-}
 
-#if gsl_HAVE_EXCEPTIONS
     //
-    // Computes x ∙ 2ˢ for x,s ∊ ℕ₀ (i.e. left-shifts x by s bits).
+    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // Uses the precomputed reciprocal of d. Enforces preconditions with `gsl_ExpectsAudit()`.
     //
-template <typename X, typename S>
-gsl_NODISCARD constexpr detail::integral_value_type<X>
-shift_left_checked(X x, S s)
+template <typename X, typename V>
+gsl_NODISCARD constexpr V
+floori(X x, divider<V> const& d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<X, V> && sizeof(detail::integral_value_type<X>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
 
-    gsl_Expects(x >= 0 && s >= 0);
+    gsl_ExpectsAudit(d.divisor() > 0);
 
-    return detail::shift_left<detail::throw_error_handler>(x, s);
+    return detail::floori(V(x), d);
 }
-#endif // gsl_HAVE_EXCEPTIONS
-
 
     //
-    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`.
+    // Uses the precomputed reciprocal of d. Enforces preconditions with `gsl_ExpectsAudit()`.
     //
-template <typename X, typename S>
-gsl_NODISCARD constexpr detail::integral_value_type<X>
-shift_right(X x, S s)
+template <typename X, typename V>
+gsl_NODISCARD constexpr V
+ceili(X x, divider<V> const& d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<X>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<X, V> && sizeof(detail::integral_value_type<X>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
 
-    gsl_Expects(x >= 0 && s >= 0);
+    gsl_ExpectsAudit(d.divisor() > 0);
 
-    return detail::shift_right<detail::ignore_error_handler>(x, s);
+    return detail::ceili(V(x), d);
 }
 
     //
-    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    // Computes ⌊n ÷ d⌋.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    // Uses the precomputed reciprocal of d.
     //
-template <typename X, typename S>
-gsl_NODISCARD constexpr detail::integral_value_type<X>
-shift_right_failfast(X x, S s)
+template <typename N, typename V>
+gsl_NODISCARD constexpr V
+ratio_floori(N n, divider<V> const& d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
-
-    gsl_Expects(x >= 0 && s >= 0);
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
 
-    return detail::shift_right<detail::failfast_error_handler>(x, s);
+    return detail::ratio_floori(V(n), d);
 }
 
     //
-    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    // Computes ⌈n ÷ d⌉.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    // Uses the precomputed reciprocal of d.
     //
-template <typename X, typename S>
-gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<X>>
-try_shift_right(X x, S s)
+template <typename N, typename V>
+gsl_NODISCARD constexpr V
+ratio_ceili(N n, divider<V> const& d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
-
-    gsl_Expects(x >= 0 && s >= 0);
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
 
-    return detail::shift_right<detail::try_error_handler>(x, s);
+    return detail::ratio_ceili(V(n), d);
 }
 
-#if gsl_HAVE_EXCEPTIONS
     //
-    // Computes ⌊x ÷ 2ˢ⌋ for x,s ∊ ℕ₀ (i.e. right-shifts x by s bits).
+    // Computes n mod d such that 0 ≤ n mod d < |d|.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // Uses the precomputed reciprocal of d.
     //
-template <typename X, typename S>
-gsl_NODISCARD constexpr detail::integral_value_type<X>
-shift_right_checked(X x, S s)
+template <typename N, typename V>
+gsl_NODISCARD constexpr V
+modulo_euclid(N n, divider<V> const& d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, S>, "arguments must be integral types or std::integral_constant<> of integral types");
-
-    gsl_Expects(x >= 0 && s >= 0);
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<N>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<N, V> && sizeof(detail::integral_value_type<N>) <= sizeof(V), "argument type must have the signedness of the divisor type and must not be wider");
 
-    return detail::shift_right<detail::throw_error_handler>(x, s);
+    return detail::modulo_euclid(V(n), d);
 }
-#endif // gsl_HAVE_EXCEPTIONS
-
 
     //
-    // Computes bᵉ for e ∊ ℕ₀.
+    // Computes ⌊a ∙ b ÷ d⌋ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
     // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
     //
-template <typename B, typename E>
-gsl_NODISCARD constexpr detail::integral_value_type<B>
-powi(B b, E e)
+template <typename EH = default_error_handler, typename A, typename B, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::muldiv_floori_op, A, B, D>
+muldiv_floori(A a, B b, D d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(e >= 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::powi<detail::ignore_error_handler>(b, e);
+    return detail::evaluate<EH, detail::muldiv_floori_op>(a, b, d);
 }
 
     //
-    // Computes bᵉ for e ∊ ℕ₀.
+    // Computes ⌊a ∙ b ÷ d⌋ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
     // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
     //
-template <typename B, typename E>
-gsl_NODISCARD constexpr detail::integral_value_type<B>
-powi_failfast(B b, E e)
+template <typename A, typename B, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::muldiv_floori_op, A, B, D>
+muldiv_floori_failfast(A a, B b, D d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(e >= 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::powi<detail::failfast_error_handler>(b, e);
+    return detail::evaluate<detail::failfast_error_handler, detail::muldiv_floori_op>(a, b, d);
 }
 
     //
-    // Computes bᵉ for e ∊ ℕ₀.
+    // Computes ⌊a ∙ b ÷ d⌋ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
     // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
     //
-template <typename B, typename E>
-gsl_NODISCARD constexpr arithmetic_result<detail::integral_value_type<B>>
-try_powi(B b, E e)
+template <typename A, typename B, typename D>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B, D>>
+try_muldiv_floori(A a, B b, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(e >= 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::powi<detail::try_error_handler>(b, e);
+    return detail::record_try_result(detail::muldiv_floori<detail::try_error_handler>(a, b, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
-    // Computes bᵉ for e ∊ ℕ₀.
+    // Computes ⌊a ∙ b ÷ d⌋ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
     //
-template <typename B, typename E>
-gsl_NODISCARD constexpr detail::integral_value_type<B>
-powi_checked(B b, E e)
+template <typename A, typename B, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::muldiv_floori_op, A, B, D>
+muldiv_floori_checked(A a, B b, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<B, E>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(e >= 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::powi<detail::throw_error_handler>(b, e);
+    return detail::checked_result<arithmetic_operation::muldiv_floori>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::muldiv_floori>, detail::muldiv_floori_op>(a, b, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
 
     //
-    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
-    //ᅟ
-    // Enforces preconditions with `gsl_Expects()`.
-    //
-template <typename X, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<X, D>
-floori(X x, D d)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
-
-    gsl_Expects(x >= 0 && d > 0);
-
-    return detail::floori(x, d);
-}
-
-
-    //
-    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
+    // Computes ⌈a ∙ b ÷ d⌉ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
     // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
     //
-template <typename X, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<X, D>
-ceili(X x, D d)
+template <typename EH = default_error_handler, typename A, typename B, typename D>
+gsl_NODISCARD constexpr detail::result_or_constant<EH, detail::muldiv_ceili_op, A, B, D>
+muldiv_ceili(A a, B b, D d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(x >= 0 && d > 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::ceili<detail::ignore_error_handler>(x, d);
+    return detail::evaluate<EH, detail::muldiv_ceili_op>(a, b, d);
 }
 
     //
-    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
+    // Computes ⌈a ∙ b ÷ d⌉ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
     // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
     //
-template <typename X, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<X, D>
-ceili_failfast(X x, D d)
+template <typename A, typename B, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::muldiv_ceili_op, A, B, D>
+muldiv_ceili_failfast(A a, B b, D d)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(x >= 0 && d > 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::ceili<detail::failfast_error_handler>(x, d);
+    return detail::evaluate<detail::failfast_error_handler, detail::muldiv_ceili_op>(a, b, d);
 }
 
     //
-    // Computes xᵉ for d ∊ ℕ₀.
+    // Computes ⌈a ∙ b ÷ d⌉ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
     // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
     //
-template <typename X, typename D>
-gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<X, D>>
-try_ceili(X x, D d)
+template <typename A, typename B, typename D>
+gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B, D>>
+try_muldiv_ceili(A a, B b, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(x >= 0 && d > 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::ceili<detail::try_error_handler>(x, d);
+    return detail::record_try_result(detail::muldiv_ceili<detail::try_error_handler>(a, b, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
-    // Computes xᵉ for d ∊ ℕ₀.
+    // Computes ⌈a ∙ b ÷ d⌉ for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // The product a ∙ b is computed with double width, so only a result that is not representable is an error.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
     //
-template <typename X, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<X, D>
-ceili_checked(X x, D d)
+template <typename A, typename B, typename D>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::muldiv_ceili_op, A, B, D>
+muldiv_ceili_checked(A a, B b, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<X, D>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<X, D>, "argument types must have identical signedness");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B, D>, "arguments must be integral types or std::integral_constant<> of integral types");
+    static_assert(detail::have_same_signedness_v<A, B, D>, "argument types must have identical signedness");
 
-    gsl_Expects(x >= 0 && d > 0);
+    gsl_Expects(a >= 0 && b >= 0 && d > 0);
 
-    return detail::ceili<detail::throw_error_handler>(x, d);
+    return detail::checked_result<arithmetic_operation::muldiv_ceili>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::muldiv_ceili>, detail::muldiv_ceili_op>(a, b, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
 
-    //
-    // Computes ⌊n ÷ d⌋ for n ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
-    //ᅟ
-    // Enforces preconditions with `gsl_Expects()`.
-    //
-template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-ratio_floori(N n, D d)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
-
-    gsl_Expects(n >= 0 && d > 0);
-
-    return detail::ratio_floori(n, d);
-}
-
-
-    //
-    // Computes ⌈n ÷ d⌉ for n ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
-    //ᅟ
-    // Enforces preconditions with `gsl_Expects()`.
-    //
-template <typename N, typename D>
-gsl_NODISCARD constexpr detail::common_integral_value_type<N, D>
-ratio_ceili(N n, D d)
-{
-    static_assert(detail::are_value_types_integral_arithmetic_types_v<N, D>, "arguments must be integral types or std::integral_constant<> of integral types");
-    static_assert(detail::have_same_signedness_v<N, D>, "argument types must have identical signedness");
-
-    gsl_Expects(n >= 0 && d > 0);
-
-    return detail::ratio_ceili(n, d);
-}
-
-
     //
     // Computes ⌊log x ÷ log b⌋ for x,b ∊ ℕ, x > 0, b > 1.
     //ᅟ
     // Enforces preconditions with `gsl_Expects()`.
     //
 template <typename E, typename X, typename B>
-gsl_NODISCARD constexpr E
+gsl_NODISCARD constexpr detail::value_or_constant<detail::log_floori_op<E>, X, B>
 log_floori(X x, B b)
 {
     static_assert(detail::are_integral_arithmetic_types_v<E>, "result type must be an integral type");
@@ -858,7 +3317,7 @@ log_floori(X x, B b)
 
     gsl_Expects(x > 0 && b > 1);
 
-    return detail::log_floori<E>(x, b);
+    return detail::evaluate<detail::ignore_error_handler, detail::log_floori_op<E>>(x, b);
 }
 
 
@@ -868,7 +3327,7 @@ log_floori(X x, B b)
     // Enforces preconditions with `gsl_Expects()`.
     //
 template <typename E, typename X, typename B>
-gsl_NODISCARD constexpr E
+gsl_NODISCARD constexpr detail::value_or_constant<detail::log_ceili_op<E>, X, B>
 log_ceili(X x, B b)
 {
     static_assert(detail::are_integral_arithmetic_types_v<E>, "result type must be an integral type");
@@ -876,7 +3335,7 @@ log_ceili(X x, B b)
 
     gsl_Expects(x > 0 && b > 1);
 
-    return detail::log_ceili<E>(x, b);
+    return detail::evaluate<detail::ignore_error_handler, detail::log_ceili_op<E>>(x, b);
 }
 
 
@@ -942,7 +3401,7 @@ factorize_ceili_failfast(X x, B b)
     //
 template <typename E, typename X, typename B>
 gsl_NODISCARD constexpr arithmetic_result<factorization<detail::common_integral_value_type<X, B>, E, 1>>
-try_factorize_ceili(X x, B b)
+try_factorize_ceili(X x, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_integral_arithmetic_types_v<E>, "result type must be an integral type");
     static_assert(detail::are_value_types_integral_arithmetic_types_v<X, B>, "arguments must be integral types or std::integral_constant<> of integral types");
@@ -950,18 +3409,18 @@ try_factorize_ceili(X x, B b)
 
     gsl_Expects(x > 0 && b > 1);
 
-    return detail::factorize_ceili<detail::try_error_handler, E>(x, b);
+    return detail::record_try_result(detail::factorize_ceili<detail::try_error_handler, E>(x, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
     // Given x,b ∊ ℕ, x > 0, b > 1, returns (r, e) such that x = bᵉ - r with r ≥ 0 minimal.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
     //
 template <typename E, typename X, typename B>
 gsl_NODISCARD constexpr factorization<detail::integral_value_type<X>, E, 1>
-factorize_ceili_checked(X x, B b)
+factorize_ceili_checked(X x, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_integral_arithmetic_types_v<E>, "result type must be an integral type");
     static_assert(detail::are_value_types_integral_arithmetic_types_v<X, B>, "arguments must be integral types or std::integral_constant<> of integral types");
@@ -969,7 +3428,8 @@ factorize_ceili_checked(X x, B b)
 
     gsl_Expects(x > 0 && b > 1);
 
-    return detail::factorize_ceili<detail::throw_error_handler, E>(x, b);
+    return detail::checked_result<arithmetic_operation::factorize_ceili>(
+        detail::factorize_ceili<detail::checked_error_handler<arithmetic_operation::factorize_ceili>, E>(x, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
@@ -1036,7 +3496,7 @@ factorize_ceili_failfast(X x, A a, B b)
     //
 template <typename E, typename X, typename A, typename B>
 gsl_NODISCARD constexpr arithmetic_result<factorization<detail::common_integral_value_type<X, A, B>, E, 2>>
-try_factorize_ceili(X x, A a, B b)
+try_factorize_ceili(X x, A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_integral_arithmetic_types_v<E>, "result type must be an integral type");
     static_assert(detail::are_value_types_integral_arithmetic_types_v<X, A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
@@ -1044,18 +3504,18 @@ try_factorize_ceili(X x, A a, B b)
 
     gsl_Expects(x > 0 && a > 1 && b > 1 && a != b);
 
-    return detail::factorize_ceili<detail::try_error_handler, E>(x, a, b);
+    return detail::record_try_result(detail::factorize_ceili<detail::try_error_handler, E>(x, a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 #if gsl_HAVE_EXCEPTIONS
     //
     // Given x,a,b ∊ ℕ, x > 0, a,b > 1, a ≠ b, returns (r,{ i, j }) such that x = aⁱ ∙ bʲ - r with r ≥ 0 minimal.
     //ᅟ
-    // Enforces preconditions with `gsl_Expects()`. Throws `std::system_error` upon overflow.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
     //
 template <typename E, typename X, typename A, typename B>
 gsl_NODISCARD constexpr factorization<detail::common_integral_value_type<X, A, B>, E, 2>
-factorize_ceili_checked(X x, A a, B b)
+factorize_ceili_checked(X x, A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_integral_arithmetic_types_v<E>, "result type must be an integral type");
     static_assert(detail::are_value_types_integral_arithmetic_types_v<X, A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
@@ -1063,7 +3523,8 @@ factorize_ceili_checked(X x, A a, B b)
 
     gsl_Expects(x > 0 && a > 1 && b > 1 && a != b);
 
-    return detail::factorize_ceili<detail::throw_error_handler, E>(x, a, b);
+    return detail::checked_result<arithmetic_operation::factorize_ceili>(
+        detail::factorize_ceili<detail::checked_error_handler<arithmetic_operation::factorize_ceili>, E>(x, a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 #endif // gsl_HAVE_EXCEPTIONS
 
@@ -1075,13 +3536,13 @@ factorize_ceili_checked(X x, A a, B b)
     // Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::gcd_op, A, B>
 gcd_failfast(A a, B b)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::gcd<detail::failfast_error_handler>(a, b);
+    return detail::evaluate<detail::failfast_error_handler, detail::gcd_op>(a, b);
 }
 
     //
@@ -1091,28 +3552,29 @@ gcd_failfast(A a, B b)
     //
 template <typename A, typename B>
 gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B>>
-try_gcd(A a, B b)
+try_gcd(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::gcd<detail::try_error_handler>(a, b);
+    return detail::record_try_result(detail::gcd<detail::try_error_handler>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 # if gsl_HAVE_EXCEPTIONS
     //
     // Computes the greatest common divisor of a and b.
     //ᅟ
-    // Throws `std::system_error` upon overflow.
+    // Throws `overflow_error` upon overflow.
     //
 template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
-gcd_checked(A a, B b)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::gcd_op, A, B>
+gcd_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::gcd<detail::throw_error_handler>(a, b);
+    return detail::checked_result<arithmetic_operation::gcd>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::gcd>, detail::gcd_op>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 # endif // gsl_HAVE_EXCEPTIONS
 
@@ -1123,13 +3585,13 @@ gcd_checked(A a, B b)
     // Uses `gsl_Assert()` to check that no overflow occurs.
     //
 template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
+gsl_NODISCARD constexpr detail::value_or_constant<detail::lcm_op, A, B>
 lcm_failfast(A a, B b)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::lcm<detail::failfast_error_handler>(a, b);
+    return detail::evaluate<detail::failfast_error_handler, detail::lcm_op>(a, b);
 }
 
     //
@@ -1139,28 +3601,29 @@ lcm_failfast(A a, B b)
     //
 template <typename A, typename B>
 gsl_NODISCARD constexpr arithmetic_result<detail::common_integral_value_type<A, B>>
-try_lcm(A a, B b)
+try_lcm(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::lcm<detail::try_error_handler>(a, b);
+    return detail::record_try_result(detail::lcm<detail::try_error_handler>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 
 # if gsl_HAVE_EXCEPTIONS
     //
     // Computes the least common multiple of a and b.
     //ᅟ
-    // Throws `std::system_error` upon overflow.
+    // Throws `overflow_error` upon overflow.
     //
 template <typename A, typename B>
-gsl_NODISCARD constexpr detail::common_integral_value_type<A, B>
-lcm_checked(A a, B b)
+gsl_NODISCARD constexpr detail::value_or_constant<detail::lcm_op, A, B>
+lcm_checked(A a, B b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
 {
     static_assert(detail::are_value_types_integral_arithmetic_types_v<A, B>, "arguments must be integral types or std::integral_constant<> of integral types");
     static_assert(detail::have_same_signedness_v<A, B>, "argument types must have identical signedness");
 
-    return detail::lcm<detail::throw_error_handler>(a, b);
+    return detail::checked_result<arithmetic_operation::lcm>(
+        detail::evaluate<detail::checked_error_handler<arithmetic_operation::lcm>, detail::lcm_op>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
 }
 # endif // gsl_HAVE_EXCEPTIONS
 #endif // gsl_CPP17_OR_GREATER
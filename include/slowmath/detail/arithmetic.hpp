@@ -3,10 +3,15 @@
 #define INCLUDED_SLOWMATH_DETAIL_ARITHMETIC_HPP_
 
 
-#include <type_traits>  // for integral_constant<>, make_unsigned<>, is_signed<>
+#include <climits>       // for CHAR_BIT
+#include <cstdint>       // for int64_t, uint32_t
+#include <type_traits>   // for integral_constant<>, common_type<>
+#include <system_error>  // for errc
 
-#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, common_integral_value_type<>, integral_value_type<>, result_t<>, has_wider_type<>
-#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK()
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, is_signed_v<>, make_signed_t<>, make_unsigned_t<>, common_integral_value_type<>, integral_value_type<>, result_t<>, has_wider_type<>, has_native_wider_type<>, is_common_result_type<>, is_integral_constant<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK(), SLOWMATH_DETAIL_UNLIKELY(), try_error_handler, wrapping_result<>
+#include <slowmath/detail/intrinsics.hpp>   // for is_constant_evaluated(), add_overflow(), subtract_overflow(), multiply_overflow(), have_multiply_overflow_v<>, have_mixed_multiply_overflow_v<>
+#include <slowmath/detail/double-word.hpp>  // for widening_add(), widening_multiply(), widening_multiply_add(), widening_multiply_subtract(), fits(), truncate(), saturate()
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -26,6 +31,9 @@ namespace detail
 
     // The implementations below have borrowed heavily from the suggestions made and examples used in the SEI CERT C Coding Standard:
     // https://wiki.sei.cmu.edu/confluence/display/c/
+    //
+    // `add()`, `subtract()`, and `multiply()` use compiler intrinsics at runtime where available. The portable implementations
+    // are used in constant expressions and for compilers without intrinsics.
 
 
 template <typename EH, typename V>
@@ -33,9 +41,9 @@ constexpr result_t<EH, integral_value_type<V>>
 absi(V v)
 {
     using V0 = integral_value_type<V>;
-    using S = std::make_signed_t<V0>;
+    using S = make_signed_t<V0>;
 
-    if (std::is_signed<V0>::value) // should be `if constexpr` in C++17
+    if (is_signed_v<V0>) // should be `if constexpr` in C++17
     {
             // This assumes a two's complement representation.
         SLOWMATH_DETAIL_OVERFLOW_CHECK(v != min_v<V0>);
@@ -54,7 +62,7 @@ negate(V v)
 {
     using V0 = integral_value_type<V>;
 
-    if (std::is_signed<V0>::value) // should be `if constexpr` in C++17
+    if (is_signed_v<V0>) // should be `if constexpr` in C++17
     {
             // This assumes a two's complement representation.
         SLOWMATH_DETAIL_OVERFLOW_CHECK(v != min_v<V0>);
@@ -67,30 +75,48 @@ negate(V v)
 }
 
 
+    // Computes |v| as an unsigned number, which is representable even for v = min_v<V>.
+template <typename V>
+constexpr make_unsigned_t<V>
+magnitude(V v)
+{
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+        // This assumes a two's complement representation.
+    return is_signed_v<V> && S(v) < 0 ? U(U(0) - U(v)) : U(v); // cast to signed to avoid warning about pointless unsigned comparison
+}
+
+template <typename V>
+constexpr bool
+is_negative(V v)
+{
+    using S = make_signed_t<V>;
+
+    return is_signed_v<V> && S(v) < 0; // cast to signed to avoid warning about pointless unsigned comparison
+}
+
+
 template <typename EH, typename A, typename B>
 constexpr result_t<EH, common_integral_value_type<A, B>>
 add_narrow(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
-    using UV = std::make_unsigned_t<V>;
-    using W = wider_type<V>;
-    using UW = std::make_unsigned_t<W>;
 
-        // This assumes a two's complement representation.
-    W result = W(a) + W(b);
-    SLOWMATH_DETAIL_OVERFLOW_CHECK(UW(result - W(min_v<V>)) <= max_v<UV>);
-    return EH::make_result(V(result));
+    auto result = detail::widening_add<V>(a, b);
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<V>(result));
+    return EH::make_result(detail::truncate<V>(result));
 }
 template <typename EH, typename A, typename B>
 constexpr result_t<EH, common_integral_value_type<A, B>>
 add_wide(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
-    using S = std::make_signed_t<V>;
-    using U = std::make_unsigned_t<V>;
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
 
     V result = V(U(a) + U(b));
-    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    if (is_signed_v<V>) // should be `if constexpr` in C++17
     {
             // cast to signed to avoid warning about pointless unsigned comparison
         SLOWMATH_DETAIL_OVERFLOW_CHECK(
@@ -121,18 +147,27 @@ add(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
 
-    return detail::add_0<EH>(has_wider_type<V>{ }, a, b);
+#if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+    if (!detail::is_constant_evaluated())
+    {
+        V result = 0;
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(!detail::add_overflow(V(a), V(b), result));
+        return EH::make_result(result);
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+        // Emulating a double-word addition is more expensive than the case analysis in `add_wide()`.
+    return detail::add_0<EH>(has_native_wider_type<V>{ }, a, b);
 }
 
 
 template <typename EH, typename A, typename B>
 constexpr result_t<EH, common_integral_value_type<A, B>>
-subtract(A a, B b)
+subtract_0(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
-    using S = std::make_signed_t<V>;
+    using S = make_signed_t<V>;
 
-    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    if (is_signed_v<V>) // should be `if constexpr` in C++17
     {
             // cast to signed to avoid warning about pointless unsigned comparison
         SLOWMATH_DETAIL_OVERFLOW_CHECK(
@@ -145,6 +180,22 @@ subtract(A a, B b)
     }
     return EH::make_result(V(a - b));
 }
+template <typename EH, typename A, typename B>
+constexpr result_t<EH, common_integral_value_type<A, B>>
+subtract(A a, B b)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+    using V = common_integral_value_type<A, B>;
+
+    if (!detail::is_constant_evaluated())
+    {
+        V result = 0;
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(!detail::subtract_overflow(V(a), V(b), result));
+        return EH::make_result(result);
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+    return detail::subtract_0<EH>(a, b);
+}
 
 
 template <typename EH, typename A, typename B>
@@ -152,34 +203,40 @@ constexpr result_t<EH, common_integral_value_type<A, B>>
 multiply_narrow(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
-    using UV = std::make_unsigned_t<V>;
-    using W = wider_type<V>;
-    using UW = std::make_unsigned_t<W>;
 
-        // This assumes a two's complement representation.
-    W result = W(a) * W(b);
-    SLOWMATH_DETAIL_OVERFLOW_CHECK(UW(result - W(min_v<V>)) <= max_v<UV>);
-    return EH::make_result(V(result));
+    auto result = detail::widening_multiply<V>(a, b);
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<V>(result));
+    return EH::make_result(detail::truncate<V>(result));
 }
 template <typename EH, typename A, typename B>
 constexpr result_t<EH, common_integral_value_type<A, B>>
 multiply_wide(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
-    using S = std::make_signed_t<V>;
-
-    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
-    {
-            // cast to signed to avoid warning about pointless unsigned comparison
-        SLOWMATH_DETAIL_OVERFLOW_CHECK(
-            !(S(a) > 0 && ((S(b) > 0 && S(a) > S(max_v<V> / b)) || (S(b) <= 0 && S(b < min_v<V> / a))))
-         && !(S(a) < 0 && ((S(b) > 0 && S(a) < S(min_v<V> / b)) || (S(b) <= 0 && S(b < max_v<V> / a)))));
-    }
-    else
-    {
-        SLOWMATH_DETAIL_OVERFLOW_CHECK(!(b > 0 && a > max_v<V> / b));
-    }
-    return EH::make_result(V(a * b));
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+    constexpr int halfBits = sizeof(V) * CHAR_BIT / 2;
+    constexpr U halfMask = U(U(1) << halfBits) - 1;
+
+        // There is no wider type, so we multiply the magnitudes with half-word multiplications:
+        //
+        //     |a| ∙ |b| = (a₁ ∙ 2ᴺᐟ² + a₀) ∙ (b₁ ∙ 2ᴺᐟ² + b₀) = a₁ ∙ b₁ ∙ 2ᴺ + (a₁ ∙ b₀ + a₀ ∙ b₁) ∙ 2ᴺᐟ² + a₀ ∙ b₀
+        //
+        // The product overflows if both a₁ and b₁ are non-zero, in which case we do not need to compute any partial product.
+        // Otherwise at most one of the cross terms is non-zero, and none of the partial products can overflow.
+        // This assumes a two's complement representation.
+    bool negative = is_signed_v<V> && ((S(a) < 0) != (S(b) < 0)); // cast to signed to avoid warning about pointless unsigned comparison
+    U ua = is_signed_v<V> && S(a) < 0 ? U(-U(a)) : U(a);
+    U ub = is_signed_v<V> && S(b) < 0 ? U(-U(b)) : U(b);
+    U a1 = ua >> halfBits, a0 = ua & halfMask;
+    U b1 = ub >> halfBits, b0 = ub & halfMask;
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(a1 == 0 || b1 == 0);
+    U mid = a1 * b0 + a0 * b1;
+    SLOWMATH_DETAIL_OVERFLOW_CHECK((mid >> halfBits) == 0);
+    U lo = a0 * b0;
+    U uresult = U(lo + (mid << halfBits));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(uresult >= lo && uresult <= (negative ? U(-U(min_v<V>)) : U(max_v<V>)));
+    return EH::make_result(V(negative ? U(-uresult) : uresult));
 }
 template <typename EH, typename A, typename B>
 constexpr result_t<EH, common_integral_value_type<A, B>>
@@ -193,15 +250,553 @@ multiply_0(std::false_type /*isNarrow*/, A a, B b)
 {
     return detail::multiply_wide<EH>(a, b);
 }
+#if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+template <typename EH, typename A, typename B>
+result_t<EH, common_integral_value_type<A, B>>
+multiply_runtime(std::true_type /*haveIntrinsic*/, A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+    V result = 0;
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(!detail::multiply_overflow(V(a), V(b), result));
+    return EH::make_result(result);
+}
+template <typename EH, typename A, typename B>
+result_t<EH, common_integral_value_type<A, B>>
+multiply_runtime(std::false_type /*haveIntrinsic*/, A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+    return detail::multiply_0<EH>(has_wider_type<V>{ }, a, b);
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
 template <typename EH, typename A, typename B>
 constexpr result_t<EH, common_integral_value_type<A, B>>
-multiply(A a, B b)
+multiply_variable(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
 
+#if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+    if (!detail::is_constant_evaluated())
+    {
+        return detail::multiply_runtime<EH>(std::integral_constant<bool, have_multiply_overflow_v<V>>{ }, a, b);
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
     return detail::multiply_0<EH>(has_wider_type<V>{ }, a, b);
 }
+    // Multiplication by a constant c only requires a range check against bounds precomputed at compile time. The product a ∙ c
+    // is representable iff
+    //
+    //     ⌈min ÷ c⌉ ≤ a ≤ ⌊max ÷ c⌋      for c > 0 ,
+    //     ⌈max ÷ c⌉ ≤ a ≤ ⌊min ÷ c⌋      for c < 0 ;
+    //
+    // the truncating integer division rounds towards the bound. For c = 2ᵏ, the upper bound is max >> k. Both comparisons are
+    // folded into a single unsigned comparison.
+template <typename EH, typename A, typename C>
+constexpr result_t<EH, common_integral_value_type<A, C>>
+multiply_by_constant(A a, C)
+{
+    using V = common_integral_value_type<A, C>;
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+    constexpr V c = V(C::value);
+    constexpr bool negative = is_signed_v<V> && S(c) < 0; // cast to signed to avoid warning about pointless unsigned comparison
+    constexpr bool minusOne = is_signed_v<V> && S(c) == -1;
+    constexpr V lo = c == 0 ? V(0) : !negative ? V(min_v<V> / c) : minusOne ? V(-max_v<V>) : V(max_v<V> / c);
+    constexpr V hi = c == 0 ? V(0) : !negative ? V(max_v<V> / c) : minusOne ? max_v<V>     : V(min_v<V> / c);
+
+    if (c == 0) return EH::make_result(V(0));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(U(U(V(a)) - U(lo)) <= U(U(hi) - U(lo))); // this assumes a two's complement representation
+    return EH::make_result(V(U(V(a)) * U(c)));
+}
+template <typename EH, typename A, typename B>
+constexpr result_t<EH, common_integral_value_type<A, B>>
+multiply_constant_0(std::false_type /*isAConstant*/, std::false_type /*isBConstant*/, A a, B b)
+{
+    return detail::multiply_variable<EH>(a, b);
+}
+template <typename EH, typename A, typename B, typename IsAConstant>
+constexpr result_t<EH, common_integral_value_type<A, B>>
+multiply_constant_0(IsAConstant, std::true_type /*isBConstant*/, A a, B b)
+{
+    return detail::multiply_by_constant<EH>(a, b);
+}
+template <typename EH, typename A, typename B>
+constexpr result_t<EH, common_integral_value_type<A, B>>
+multiply_constant_0(std::true_type /*isAConstant*/, std::false_type /*isBConstant*/, A a, B b)
+{
+    return detail::multiply_by_constant<EH>(b, a);
+}
+template <typename EH, typename A, typename B>
+constexpr result_t<EH, common_integral_value_type<A, B>>
+multiply(A a, B b)
+{
+    return detail::multiply_constant_0<EH>(is_integral_constant<A>{ }, is_integral_constant<B>{ }, a, b);
+}
+
+
+    // For operands of different signedness, and for results of a type other than the common type of the operands, we compute the
+    // exact result in a wider type or in sign-magnitude representation and then check whether it is representable by the result
+    // type R. At runtime, the overflow builtins do the same with a single flag-based check.
+template <typename U>
+struct sign_magnitude
+{
+    bool negative;
+    U magnitude;
+};
+template <typename U, typename V>
+constexpr sign_magnitude<U>
+to_sign_magnitude(V v)
+{
+    using V0 = integral_value_type<V>;
+    using S = make_signed_t<V0>;
+
+        // This assumes a two's complement representation.
+    return is_signed_v<V0> && S(v) < 0 // cast to signed to avoid warning about pointless unsigned comparison
+        ? sign_magnitude<U>{ true, U(-U(V0(v))) }
+        : sign_magnitude<U>{ false, U(V0(v)) };
+}
+template <typename EH, typename R, typename U>
+constexpr result_t<EH, R>
+from_sign_magnitude(sign_magnitude<U> v)
+{
+    if (v.negative)
+    {
+            // This assumes a two's complement representation.
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(v.magnitude <= U(-U(min_v<R>)));
+        return EH::make_result(R(U(-v.magnitude)));
+    }
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(v.magnitude <= U(max_v<R>));
+    return EH::make_result(R(v.magnitude));
+}
+template <typename EH, typename R, typename U>
+constexpr result_t<EH, R>
+add_sign_magnitude(sign_magnitude<U> a, sign_magnitude<U> b)
+{
+    if (a.negative == b.negative)
+    {
+        U sum = U(a.magnitude + b.magnitude);
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(sum >= a.magnitude);
+        return detail::from_sign_magnitude<EH, R>(sign_magnitude<U>{ a.negative, sum });
+    }
+    return a.magnitude >= b.magnitude
+        ? detail::from_sign_magnitude<EH, R>(sign_magnitude<U>{ a.negative, U(a.magnitude - b.magnitude) })
+        : detail::from_sign_magnitude<EH, R>(sign_magnitude<U>{ b.negative, U(b.magnitude - a.magnitude) });
+}
+template <typename R, typename A, typename B> using mixed_unsigned_type = make_unsigned_t<std::common_type_t<R, integral_value_type<A>, integral_value_type<B>>>;
+template <typename R, typename A, typename B> struct is_mixed_narrow : std::integral_constant<bool, sizeof(mixed_unsigned_type<R, A, B>) <= sizeof(std::uint32_t)> { };
+
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+add_mixed_0(std::true_type /*isNarrow*/, A a, B b)
+{
+    using W = std::int64_t;
+
+    W result = W(integral_value_type<A>(a)) + W(integral_value_type<B>(b));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<R>(result));
+    return EH::make_result(detail::truncate<R>(result));
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+add_mixed_0(std::false_type /*isNarrow*/, A a, B b)
+{
+    using U = mixed_unsigned_type<R, A, B>;
+
+    return detail::add_sign_magnitude<EH, R>(detail::to_sign_magnitude<U>(a), detail::to_sign_magnitude<U>(b));
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+add_mixed(A a, B b)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+    if (!detail::is_constant_evaluated())
+    {
+        R result = 0;
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(!detail::add_overflow(integral_value_type<A>(a), integral_value_type<B>(b), result));
+        return EH::make_result(result);
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+    return detail::add_mixed_0<EH, R>(is_mixed_narrow<R, A, B>{ }, a, b);
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+add_to_0(std::true_type /*isCommonResultType*/, A a, B b)
+{
+    return detail::add<EH>(a, b);
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+add_to_0(std::false_type /*isCommonResultType*/, A a, B b)
+{
+    return detail::add_mixed<EH, R>(a, b);
+}
+    // Computes a + b for arguments of arbitrary signedness and checks that the result is representable by R.
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+add_to(A a, B b)
+{
+    return detail::add_to_0<EH, R>(is_common_result_type<R, A, B>{ }, a, b);
+}
+
+
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+subtract_mixed_0(std::true_type /*isNarrow*/, A a, B b)
+{
+    using W = std::int64_t;
+
+    W result = W(integral_value_type<A>(a)) - W(integral_value_type<B>(b));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<R>(result));
+    return EH::make_result(detail::truncate<R>(result));
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+subtract_mixed_0(std::false_type /*isNarrow*/, A a, B b)
+{
+    using U = mixed_unsigned_type<R, A, B>;
+
+    auto sb = detail::to_sign_magnitude<U>(b);
+    sb.negative = !sb.negative;
+    return detail::add_sign_magnitude<EH, R>(detail::to_sign_magnitude<U>(a), sb);
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+subtract_mixed(A a, B b)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+    if (!detail::is_constant_evaluated())
+    {
+        R result = 0;
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(!detail::subtract_overflow(integral_value_type<A>(a), integral_value_type<B>(b), result));
+        return EH::make_result(result);
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+    return detail::subtract_mixed_0<EH, R>(is_mixed_narrow<R, A, B>{ }, a, b);
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+subtract_to_0(std::true_type /*isCommonResultType*/, A a, B b)
+{
+    return detail::subtract<EH>(a, b);
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+subtract_to_0(std::false_type /*isCommonResultType*/, A a, B b)
+{
+    return detail::subtract_mixed<EH, R>(a, b);
+}
+    // Computes a - b for arguments of arbitrary signedness and checks that the result is representable by R.
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+subtract_to(A a, B b)
+{
+    return detail::subtract_to_0<EH, R>(is_common_result_type<R, A, B>{ }, a, b);
+}
+
+
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+multiply_mixed_0(A a, B b)
+{
+    using U = mixed_unsigned_type<R, A, B>;
+
+    auto sa = detail::to_sign_magnitude<U>(a);
+    auto sb = detail::to_sign_magnitude<U>(b);
+    auto productR = detail::multiply<EH>(sa.magnitude, sb.magnitude);
+    if (SLOWMATH_DETAIL_UNLIKELY(EH::is_error(productR))) return EH::passthrough_error(productR);
+    return detail::from_sign_magnitude<EH, R>(sign_magnitude<U>{ sa.negative != sb.negative, EH::get_value(productR) });
+}
+#if defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+template <typename EH, typename R, typename A, typename B>
+result_t<EH, R>
+multiply_mixed_runtime(std::true_type /*haveIntrinsic*/, A a, B b)
+{
+    R result = 0;
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(!detail::multiply_overflow(integral_value_type<A>(a), integral_value_type<B>(b), result));
+    return EH::make_result(result);
+}
+template <typename EH, typename R, typename A, typename B>
+result_t<EH, R>
+multiply_mixed_runtime(std::false_type /*haveIntrinsic*/, A a, B b)
+{
+    return detail::multiply_mixed_0<EH, R>(a, b);
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+multiply_mixed(A a, B b)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+    if (!detail::is_constant_evaluated())
+    {
+        return detail::multiply_mixed_runtime<EH, R>(std::integral_constant<bool, have_mixed_multiply_overflow_v<mixed_unsigned_type<R, A, B>>>{ }, a, b);
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS)
+    return detail::multiply_mixed_0<EH, R>(a, b);
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+multiply_to_0(std::true_type /*isCommonResultType*/, A a, B b)
+{
+    return detail::multiply<EH>(a, b);
+}
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+multiply_to_0(std::false_type /*isCommonResultType*/, A a, B b)
+{
+    return detail::multiply_mixed<EH, R>(a, b);
+}
+    // Computes a ∙ b for arguments of arbitrary signedness and checks that the result is representable by R.
+template <typename EH, typename R, typename A, typename B>
+constexpr result_t<EH, R>
+multiply_to(A a, B b)
+{
+    return detail::multiply_to_0<EH, R>(is_common_result_type<R, A, B>{ }, a, b);
+}
+
+
+    // `multiply_add()` and `multiply_subtract()` evaluate a ∙ b ± c in the wider type and check only the final result, so a
+    // product which does not fit but is brought back into range by c is not an error. There is no wider type for 128-bit
+    // operands, so we compute the exact product and the sum or difference as a `double_word<>` instead.
+template <typename EH, typename A, typename B, typename C>
+constexpr result_t<EH, common_integral_value_type<A, B, C>>
+multiply_add_0(std::true_type /*hasWiderType*/, A a, B b, C c)
+{
+    using V = common_integral_value_type<A, B, C>;
+
+    auto result = detail::widening_multiply_add<V>(V(a), V(b), V(c));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<V>(result));
+    return EH::make_result(detail::truncate<V>(result));
+}
+template <typename EH, typename A, typename B, typename C>
+constexpr result_t<EH, common_integral_value_type<A, B, C>>
+multiply_add_0(std::false_type /*hasWiderType*/, A a, B b, C c)
+{
+    using V = common_integral_value_type<A, B, C>;
+
+    auto result = detail::widening_multiply_add_0<V>(std::true_type{ } /*isDoubleWord*/, V(a), V(b), V(c));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits_0<V>(std::true_type{ } /*isDoubleWord*/, result));
+    return EH::make_result(detail::truncate_0<V>(std::true_type{ } /*isDoubleWord*/, result));
+}
+template <typename EH, typename A, typename B, typename C>
+constexpr result_t<EH, common_integral_value_type<A, B, C>>
+multiply_add(A a, B b, C c)
+{
+    using V = common_integral_value_type<A, B, C>;
+
+    return detail::multiply_add_0<EH>(has_wider_type<V>{ }, a, b, c);
+}
+
+template <typename EH, typename A, typename B, typename C>
+constexpr result_t<EH, common_integral_value_type<A, B, C>>
+multiply_subtract_0(std::true_type /*hasWiderType*/, A a, B b, C c)
+{
+    using V = common_integral_value_type<A, B, C>;
+
+    auto result = detail::widening_multiply_subtract<V>(V(a), V(b), V(c));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<V>(result));
+    return EH::make_result(detail::truncate<V>(result));
+}
+template <typename EH, typename A, typename B, typename C>
+constexpr result_t<EH, common_integral_value_type<A, B, C>>
+multiply_subtract_0(std::false_type /*hasWiderType*/, A a, B b, C c)
+{
+    using V = common_integral_value_type<A, B, C>;
+
+    auto result = detail::widening_multiply_subtract_0<V>(std::true_type{ } /*isDoubleWord*/, V(a), V(b), V(c));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits_0<V>(std::true_type{ } /*isDoubleWord*/, result));
+    return EH::make_result(detail::truncate_0<V>(std::true_type{ } /*isDoubleWord*/, result));
+}
+template <typename EH, typename A, typename B, typename C>
+constexpr result_t<EH, common_integral_value_type<A, B, C>>
+multiply_subtract(A a, B b, C c)
+{
+    using V = common_integral_value_type<A, B, C>;
+
+    return detail::multiply_subtract_0<EH>(has_wider_type<V>{ }, a, b, c);
+}
+
+
+    // The wrapping operations compute the result modulo 2ᴺ and whether the infinitely precise result is not representable. They
+    // are implemented without branches so that loops calling them can be vectorized. This assumes a two's complement representation.
+template <typename A, typename B>
+constexpr wrapping_result<common_integral_value_type<A, B>>
+add_wrapping(A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+    V va = V(a);
+    V vb = V(b);
+    V result = V(U(va) + U(vb));
+    if (is_signed_v<V>) // should be `if constexpr` in C++17
+    {
+            // Signed overflow occurred iff both operands have the same sign and the sign of the result differs.
+        return { result, S(S(va ^ result) & S(vb ^ result)) < 0 };
+    }
+    else
+    {
+        return { result, result < va };
+    }
+}
+template <typename A, typename B>
+constexpr wrapping_result<common_integral_value_type<A, B>>
+subtract_wrapping(A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+    V va = V(a);
+    V vb = V(b);
+    V result = V(U(va) - U(vb));
+    if (is_signed_v<V>) // should be `if constexpr` in C++17
+    {
+            // Signed overflow occurred iff the operands have different signs and the sign of the result differs from the sign of a.
+        return { result, S(S(va ^ vb) & S(va ^ result)) < 0 };
+    }
+    else
+    {
+        return { result, result > va };
+    }
+}
+template <typename A, typename B>
+constexpr wrapping_result<common_integral_value_type<A, B>>
+multiply_wrapping_0(std::true_type /*hasWiderType*/, A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+    auto product = detail::widening_multiply<V>(a, b);
+    return { detail::truncate<V>(product), !detail::fits<V>(product) };
+}
+template <typename A, typename B>
+constexpr wrapping_result<common_integral_value_type<A, B>>
+multiply_wrapping_0(std::false_type /*hasWiderType*/, A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+        // There is no wider type, so we compute the full-width product as a `double_word<>`, which does not branch either.
+    auto product = detail::widening_multiply_0<V>(std::true_type{ } /*isDoubleWord*/, V(a), V(b));
+    return { detail::truncate_0<V>(std::true_type{ } /*isDoubleWord*/, product), !detail::fits_0<V>(std::true_type{ } /*isDoubleWord*/, product) };
+}
+template <typename A, typename B>
+constexpr wrapping_result<common_integral_value_type<A, B>>
+multiply_wrapping(A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+#if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+        // The product in the 128-bit type is more expensive than the overflow intrinsic, and neither can be vectorized.
+    if (sizeof(V) > sizeof(std::uint32_t) && have_multiply_overflow_v<V> && !detail::is_constant_evaluated())
+    {
+        V result = 0;
+        bool overflow = detail::multiply_overflow(V(a), V(b), result);
+        return { result, overflow };
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+    return detail::multiply_wrapping_0(has_wider_type<V>{ }, a, b);
+}
+template <typename V>
+constexpr wrapping_result<integral_value_type<V>>
+negate_wrapping(V v)
+{
+    using V0 = integral_value_type<V>;
+    using U = make_unsigned_t<V0>;
+
+    V0 v0 = V0(v);
+    return { V0(U(0) - U(v0)), is_signed_v<V0> ? v0 == min_v<V0> : v0 != 0 };
+}
+template <typename V>
+constexpr wrapping_result<integral_value_type<V>>
+absi_wrapping(V v)
+{
+    using V0 = integral_value_type<V>;
+
+    V0 v0 = V0(v);
+    return { V0(detail::magnitude(v0)), is_signed_v<V0> && v0 == min_v<V0> };
+}
+
+
+    // The saturating operations clamp the result to the range of the result type. They are implemented without branches so that
+    // loops calling them can be vectorized: addition and subtraction compute the wrapped result and select the bound if the sign
+    // test indicates overflow, and multiplication clamps the product computed in the wider type. This assumes a two's complement
+    // representation.
+template <typename A, typename B>
+constexpr common_integral_value_type<A, B>
+add_saturating(A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+    auto result = detail::add_wrapping(a, b);
+    if (is_signed_v<V>) // should be `if constexpr` in C++17
+    {
+            // On overflow, both operands have the same sign, and the result saturates towards it.
+        V bound = V(U(S(V(a)) >> (sizeof(V) * CHAR_BIT - 1)) ^ U(max_v<V>));
+        return result.overflow ? bound : result.value;
+    }
+    else
+    {
+        return V(result.value | V(-V(result.overflow)));
+    }
+}
+template <typename A, typename B>
+constexpr common_integral_value_type<A, B>
+subtract_saturating(A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+    auto result = detail::subtract_wrapping(a, b);
+    if (is_signed_v<V>) // should be `if constexpr` in C++17
+    {
+            // On overflow, the result saturates towards the sign of a.
+        V bound = V(U(S(V(a)) >> (sizeof(V) * CHAR_BIT - 1)) ^ U(max_v<V>));
+        return result.overflow ? bound : result.value;
+    }
+    else
+    {
+        return V(result.value & V(-V(!result.overflow)));
+    }
+}
+template <typename A, typename B>
+constexpr common_integral_value_type<A, B>
+multiply_saturating_0(std::true_type /*hasWiderType*/, A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+    return detail::saturate<V>(detail::widening_multiply<V>(a, b));
+}
+template <typename A, typename B>
+constexpr common_integral_value_type<A, B>
+multiply_saturating_0(std::false_type /*hasWiderType*/, A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+    using S = make_signed_t<V>;
+
+    auto result = detail::multiply<try_error_handler>(a, b);
+    bool negative = is_signed_v<V> && ((S(V(a)) < 0) != (S(V(b)) < 0)); // cast to signed to avoid warning about pointless unsigned comparison
+    return result.ec == std::errc{ } ? result.value
+         : negative ? min_v<V>
+         : max_v<V>;
+}
+template <typename A, typename B>
+constexpr common_integral_value_type<A, B>
+multiply_saturating(A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+    return detail::multiply_saturating_0(has_wider_type<V>{ }, a, b);
+}
+
 
+    // Division and modulo can only overflow for signed types if d = -1, which a constant divisor can rule out at compile time.
+template <typename V, typename D> struct can_divide_overflow : std::integral_constant<bool, is_signed_v<V>> { };
+template <typename V, typename DV, DV D> struct can_divide_overflow<V, std::integral_constant<DV, D>> : std::integral_constant<bool, is_signed_v<V> && D == DV(-1)> { };
 
 template <typename EH, typename N, typename D>
 constexpr result_t<EH, common_integral_value_type<N, D>>
@@ -209,7 +804,7 @@ divide(N n, D d)
 {
     using V = common_integral_value_type<N, D>;
 
-    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    if (can_divide_overflow<V, D>::value) // should be `if constexpr` in C++17
     {
         SLOWMATH_DETAIL_OVERFLOW_CHECK(!(n == min_v<V> && d == -1));
     }
@@ -223,7 +818,7 @@ modulo(N n, D d)
 {
     using V = common_integral_value_type<N, D>;
 
-    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    if (can_divide_overflow<V, D>::value) // should be `if constexpr` in C++17
     {
         SLOWMATH_DETAIL_OVERFLOW_CHECK(!(n == min_v<V> && d == -1));
     }
@@ -0,0 +1,296 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_BATCH_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_BATCH_HPP_
+
+
+#include <cstddef>       // for size_t
+#include <system_error>  // for errc
+
+#include <slowmath/detail/type_traits.hpp>  // for make_unsigned_t<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_FORCEINLINE, SLOWMATH_DETAIL_UNLIKELY(), wrapping_result<>, arithmetic_result<>, try_error_handler
+#include <slowmath/detail/arithmetic.hpp>   // for add(), add_wrapping(), subtract_wrapping(), multiply_wrapping(), negate_wrapping(), absi_wrapping()
+#include <slowmath/detail/bits.hpp>         // for shift_left_wrapping()
+#include <slowmath/detail/round.hpp>        // for ceili_wrapping()
+
+
+    // On x86 with GCC or Clang, batch kernels are also compiled for AVX2 and AVX-512, and the widest instruction set supported by
+    // the processor is selected at runtime. Define `SLOWMATH_NO_ISA_DISPATCH` to compile the kernels only for the instruction set
+    // targeted by the compiler flags.
+#if !defined(SLOWMATH_NO_ISA_DISPATCH) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && !defined(__CUDA_ARCH__) && !defined(__AVX512BW__)
+# define SLOWMATH_DETAIL_ISA_DISPATCH 1
+#else
+# define SLOWMATH_DETAIL_ISA_DISPATCH 0
+#endif
+
+    // GCC vectorizes loops at -O2 only if no runtime checks or epilogues are required, which rules out the batch kernels.
+#if defined(__GNUC__) && !defined(__clang__)
+# define SLOWMATH_DETAIL_VECTORIZE  __attribute__((optimize("tree-vectorize", "vect-cost-model=dynamic")))
+#else
+# define SLOWMATH_DETAIL_VECTORIZE
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // The batch kernels apply a wrapping operation to all elements. The results of a block of elements are stored in a local buffer,
+    // and the overflow flags are OR-reduced, which the compiler can vectorize along with the operation. If the block does not
+    // overflow, the buffer is copied to the destination; otherwise, the elements of the block are checked individually to find the
+    // first offending index, and only the preceding results are copied. The operands are thus never read after the destination
+    // has been written, which permits the destination to alias an operand.
+    //
+    // The wrapping operations compute the same values as the checked operations if no overflow occurs, so the results are
+    // identical to those of the scalar functions regardless of the instruction set.
+
+struct add_wrapping_op
+{
+    template <typename A, typename B>
+    static constexpr auto
+    invoke(A a, B b)
+    {
+        return detail::add_wrapping(a, b);
+    }
+};
+struct subtract_wrapping_op
+{
+    template <typename A, typename B>
+    static constexpr auto
+    invoke(A a, B b)
+    {
+        return detail::subtract_wrapping(a, b);
+    }
+};
+struct multiply_wrapping_op
+{
+    template <typename A, typename B>
+    static constexpr auto
+    invoke(A a, B b)
+    {
+        return detail::multiply_wrapping(a, b);
+    }
+};
+struct negate_wrapping_op
+{
+    template <typename V>
+    static constexpr auto
+    invoke(V v)
+    {
+        return detail::negate_wrapping(v);
+    }
+};
+struct absi_wrapping_op
+{
+    template <typename V>
+    static constexpr auto
+    invoke(V v)
+    {
+        return detail::absi_wrapping(v);
+    }
+};
+struct shift_left_wrapping_op
+{
+    template <typename X, typename S>
+    static constexpr auto
+    invoke(X x, S s)
+    {
+        return detail::shift_left_wrapping(x, s);
+    }
+};
+struct ceili_wrapping_op
+{
+    template <typename X, typename D>
+    static constexpr auto
+    invoke(X x, D d)
+    {
+        return detail::ceili_wrapping(x, d);
+    }
+};
+
+    // The element accessors evaluate the operation `F` for the i-th element of one or two arrays, or of an array and a scalar.
+template <typename F, typename V>
+struct unary_batch
+{
+    V const* v;
+
+    constexpr auto operator ()(std::size_t i) const { return F::invoke(v[i]); }
+};
+template <typename F, typename A, typename B>
+struct binary_batch
+{
+    A const* a;
+    B const* b;
+
+    constexpr auto operator ()(std::size_t i) const { return F::invoke(a[i], b[i]); }
+};
+template <typename F, typename X, typename P>
+struct scalar_batch
+{
+    X const* x;
+    P p;
+
+    constexpr auto operator ()(std::size_t i) const { return F::invoke(x[i], p); }
+};
+
+
+struct transform_batch_kernel
+{
+    template <typename R, typename F>
+    static SLOWMATH_DETAIL_FORCEINLINE std::size_t
+    invoke(F f, R* dst, std::size_t n)
+    {
+        using U = make_unsigned_t<R>;
+
+        constexpr std::size_t blockSize = 256;
+
+        R block[blockSize];
+        for (std::size_t i0 = 0; i0 != n; )
+        {
+            std::size_t m = n - i0 > blockSize ? blockSize : n - i0;
+            U overflow = 0;
+            for (std::size_t j = 0; j != m; ++j)
+            {
+                wrapping_result<R> r = f(i0 + j);
+                block[j] = r.value;
+                overflow |= U(r.overflow);
+            }
+            if (overflow != 0)
+            {
+                m = 0;
+                while (!f(i0 + m).overflow) ++m;
+            }
+            for (std::size_t j = 0; j != m; ++j)
+            {
+                dst[i0 + j] = block[j];
+            }
+            if (overflow != 0) return i0 + m;
+            i0 += m;
+        }
+        return n;
+    }
+};
+
+    // A kernel is a class with a static member function `invoke()` which is always inlined, so that it is compiled for the
+    // instruction set of the function which calls it.
+template <typename K, typename... As>
+SLOWMATH_DETAIL_VECTORIZE auto
+invoke_kernel_baseline(As... as)
+{
+    return K::invoke(as...);
+}
+
+#if SLOWMATH_DETAIL_ISA_DISPATCH
+enum class batch_isa : unsigned char
+{
+    baseline,
+    avx2,
+    avx512
+};
+
+inline batch_isa
+detect_batch_isa() noexcept
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq")) return batch_isa::avx512;
+    if (__builtin_cpu_supports("avx2")) return batch_isa::avx2;
+    return batch_isa::baseline;
+}
+
+inline batch_isa
+get_batch_isa() noexcept
+{
+    static batch_isa const isa = detail::detect_batch_isa();
+    return isa;
+}
+
+template <typename K, typename... As>
+__attribute__((target("avx2"))) SLOWMATH_DETAIL_VECTORIZE auto
+invoke_kernel_avx2(As... as)
+{
+    return K::invoke(as...);
+}
+template <typename K, typename... As>
+__attribute__((target("avx512f,avx512bw,avx512vl,avx512dq"))) SLOWMATH_DETAIL_VECTORIZE auto
+invoke_kernel_avx512(As... as)
+{
+    return K::invoke(as...);
+}
+#endif // SLOWMATH_DETAIL_ISA_DISPATCH
+
+    // Invokes the kernel `K` compiled for the widest instruction set supported by the processor.
+template <typename K, typename... As>
+auto
+invoke_kernel(As... as)
+{
+#if SLOWMATH_DETAIL_ISA_DISPATCH
+    switch (detail::get_batch_isa())
+    {
+    case batch_isa::avx512: return detail::invoke_kernel_avx512<K>(as...);
+    case batch_isa::avx2:   return detail::invoke_kernel_avx2<K>(as...);
+    case batch_isa::baseline: break;
+    }
+#endif // SLOWMATH_DETAIL_ISA_DISPATCH
+    return detail::invoke_kernel_baseline<K>(as...);
+}
+
+
+    // Stores the results of the wrapping operation `f` for the indices 0, …, n - 1 in dst. Returns the number of elements computed,
+    // which is less than n iff the operation overflows for the element at that index; the elements of dst from that index on
+    // then retain their previous values.
+template <typename R, typename F>
+std::size_t
+transform_batch(F f, R* dst, std::size_t n)
+{
+    return detail::invoke_kernel<transform_batch_kernel>(f, dst, n);
+}
+
+    // Stores the running sums init + src[0] + … + src[i] (inclusive scan) or init + src[0] + … + src[i - 1] (exclusive scan) for
+    // the indices 0, …, n - 1 in dst. Returns the number of elements computed, which is less than n iff the running sum for the
+    // element at that index overflows; the elements of dst from that index on then retain their previous values. The sum of all
+    // elements is not stored by an exclusive scan and hence not checked.
+    //
+    // Unlike the other batch operations, the scan is not computed in blocks: the running sum is a loop-carried dependency which
+    // the compiler cannot vectorize, and a predictable branch on the overflow flag of the scalar addition is cheaper than
+    // deferring the check. Every
+    // element of src is read before the corresponding element of dst is written, which permits in-place scans.
+template <bool Inclusive, typename R, typename V>
+std::size_t
+scan_batch(V const* src, R* dst, std::size_t n, R init)
+{
+    std::size_t numAdds = Inclusive || n == 0 ? n : n - 1;
+    R sum = init;
+    for (std::size_t i = 0; i != numAdds; ++i)
+    {
+        arithmetic_result<R> r = detail::add<try_error_handler>(sum, R(src[i]));
+        if (SLOWMATH_DETAIL_UNLIKELY(r.ec != std::errc{ }))
+        {
+            if (Inclusive) return i;
+            dst[i] = sum;
+            return i + 1;
+        }
+        dst[i] = Inclusive ? r.value : sum;
+        sum = r.value;
+    }
+    if (numAdds != n) dst[n - 1] = sum;
+    return n;
+}
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_BATCH_HPP_
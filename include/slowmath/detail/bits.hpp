@@ -3,14 +3,16 @@
 #define INCLUDED_SLOWMATH_DETAIL_BITS_HPP_
 
 
-#include <climits>  // for CHAR_BIT
+#include <climits>      // for CHAR_BIT
+#include <type_traits>  // for integral_constant<>
 
-#include <slowmath/detail/type_traits.hpp>  // for max_v<>, integral_value_type<>, result_t<>
-#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK()
+#include <slowmath/detail/type_traits.hpp>  // for max_v<>, integral_value_type<>, make_unsigned_t<>, result_t<>, is_integral_constant<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK(), wrapping_result<>
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
 # pragma warning(push)
+# pragma warning(disable: 4146) // unary minus operator applied to unsigned type, result still unsigned
 # pragma warning(disable: 4702) // unreachable code
 #endif // defined(_MSC_VER) && !defined(__clang__)
 
@@ -29,21 +31,57 @@ shift_right(X x, S s)
     using V0 = integral_value_type<X>;
     using S0 = integral_value_type<S>;
 
-    SLOWMATH_DETAIL_OVERFLOW_CHECK(s < S0(sizeof(X) * CHAR_BIT));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(s < S0(sizeof(V0) * CHAR_BIT));
     return EH::make_result(V0(x >> V0(s)));
 }
 
 
 template <typename EH, typename X, typename S>
 constexpr result_t<EH, integral_value_type<X>>
-shift_left(X x, S s)
+shift_left_0(std::false_type /*isConstantShift*/, X x, S s)
+{
+    using V0 = integral_value_type<X>;
+    using S0 = integral_value_type<S>;
+
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(s < S0(sizeof(V0) * CHAR_BIT) && x <= (max_v<V0> >> s));
+    return EH::make_result(V0(x << V0(s)));
+}
+template <typename EH, typename X, typename S>
+constexpr result_t<EH, integral_value_type<X>>
+shift_left_0(std::true_type /*isConstantShift*/, X x, S)
 {
     using V0 = integral_value_type<X>;
     using S0 = integral_value_type<S>;
 
-    SLOWMATH_DETAIL_OVERFLOW_CHECK(s < S0(sizeof(X) * CHAR_BIT) && x <= (max_v<V0> >> s));
+        // For a constant shift, the range check and the bound are computed at compile time.
+    constexpr bool inRange = S::value < S0(sizeof(V0) * CHAR_BIT);
+    constexpr S0 s = inRange ? S::value : 0;
+    constexpr V0 m = V0(max_v<V0> >> s);
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(inRange && x <= m);
     return EH::make_result(V0(x << V0(s)));
 }
+template <typename EH, typename X, typename S>
+constexpr result_t<EH, integral_value_type<X>>
+shift_left(X x, S s)
+{
+    return detail::shift_left_0<EH>(is_integral_constant<S>{ }, x, s);
+}
+
+    // Computes x ∙ 2ˢ modulo 2ᴺ for x,s ∊ ℕ₀ and whether the result is not representable, without branching; cf. the wrapping
+    // operations in "arithmetic.hpp". The shift is carried out in the unsigned type, and a shift count out of range yields 0.
+template <typename X, typename S>
+constexpr wrapping_result<integral_value_type<X>>
+shift_left_wrapping(X x, S s)
+{
+    using V0 = integral_value_type<X>;
+    using S0 = integral_value_type<S>;
+    using U = make_unsigned_t<V0>;
+
+    V0 x0 = V0(x);
+    bool inRange = S0(s) < S0(sizeof(V0) * CHAR_BIT);
+    S0 s0 = inRange ? S0(s) : S0(0);
+    return { V0(U(U(x0) << s0) & U(-U(inRange))), !inRange || x0 > V0(max_v<V0> >> s0) };
+}
 
 
 } // namespace detail
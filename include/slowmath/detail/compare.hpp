@@ -0,0 +1,94 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_COMPARE_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_COMPARE_HPP_
+
+
+#include <type_traits>  // for integral_constant<>, common_type<>
+
+#include <slowmath/detail/type_traits.hpp>  // for is_signed_v<>, make_signed_t<>, make_unsigned_t<>, integral_value_type<>, have_same_signedness<>
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // The usual arithmetic conversions convert a signed operand to unsigned if the other operand is unsigned and at least as wide,
+    // which renders built-in comparisons of arguments of different signedness meaningless for negative values. We therefore
+    // compare the signs first and then compare the values as unsigned numbers.
+
+template <typename A, typename B>
+constexpr bool
+equal_0(std::true_type /*haveSameSignedness*/, A a, B b)
+{
+    return integral_value_type<A>(a) == integral_value_type<B>(b);
+}
+template <typename A, typename B>
+constexpr bool
+equal_0(std::false_type /*haveSameSignedness*/, A a, B b)
+{
+    using A0 = integral_value_type<A>;
+    using B0 = integral_value_type<B>;
+    using SA = make_signed_t<A0>;
+    using SB = make_signed_t<B0>;
+    using U = make_unsigned_t<std::common_type_t<A0, B0>>;
+
+        // cast to signed to avoid warning about pointless unsigned comparison
+    return (is_signed_v<A0> ? SA(a) >= 0 : SB(b) >= 0)
+        && U(A0(a)) == U(B0(b));
+}
+template <typename A, typename B>
+constexpr bool
+equal(A a, B b)
+{
+    return detail::equal_0(have_same_signedness<A, B>{ }, a, b);
+}
+
+template <typename A, typename B>
+constexpr bool
+less_0(std::true_type /*haveSameSignedness*/, A a, B b)
+{
+    return integral_value_type<A>(a) < integral_value_type<B>(b);
+}
+template <typename A, typename B>
+constexpr bool
+less_0(std::false_type /*haveSameSignedness*/, A a, B b)
+{
+    using A0 = integral_value_type<A>;
+    using B0 = integral_value_type<B>;
+    using SA = make_signed_t<A0>;
+    using SB = make_signed_t<B0>;
+    using U = make_unsigned_t<std::common_type_t<A0, B0>>;
+
+        // cast to signed to avoid warning about pointless unsigned comparison
+    return is_signed_v<A0>
+        ? SA(a) < 0 || U(A0(a)) < U(B0(b))
+        : SB(b) >= 0 && U(A0(a)) < U(B0(b));
+}
+template <typename A, typename B>
+constexpr bool
+less(A a, B b)
+{
+    return detail::less_0(have_same_signedness<A, B>{ }, a, b);
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_COMPARE_HPP_
@@ -0,0 +1,340 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_CONSTANT_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_CONSTANT_HPP_
+
+
+#include <utility>       // for declval<>()
+#include <type_traits>   // for integral_constant<>
+#include <system_error>  // for errc
+
+#include <gsl-lite/gsl-lite.hpp>  // for conjunction<>, gsl_CPP17_OR_GREATER
+
+#include <slowmath/detail/type_traits.hpp>  // for is_integral_constant<>, integral_value_type<>, common_integral_value_type<>, explicit_or_common_integral_value_type<>, result_t<>
+#include <slowmath/detail/errors.hpp>       // for ignore_error_handler, try_error_handler
+
+#include <slowmath/detail/arithmetic.hpp>   // for absi(), negate(), add_to(), subtract_to(), multiply_to(), multiply_add(), multiply_subtract(), divide(), modulo()
+#include <slowmath/detail/bits.hpp>         // for shift_right(), shift_left()
+#include <slowmath/detail/narrow.hpp>       // for narrow()
+#include <slowmath/detail/gcd-lcm.hpp>      // for gcd(), lcm()
+#include <slowmath/detail/pow-log.hpp>      // for square(), powi(), log_floori(), log_ceili()
+#include <slowmath/detail/round.hpp>        // for floori(), ceili(), ratio_floori(), ratio_ceili(), modulo_euclid(), muldiv_floori(), muldiv_ceili()
+#include <slowmath/detail/divider.hpp>      // for divmod()
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // If all arguments of an operation are `std::integral_constant<>`, the operation is evaluated at compile time and the result
+    // is returned as an `std::integral_constant<>`, which keeps e.g. static extents in the type system. The operation is always
+    // evaluated with `try_error_handler` so that overflow can be reported as a compile error regardless of the error handler
+    // requested by the caller.
+    //
+    // The following function objects wrap the operations which support compile-time evaluation.
+
+template <typename R>
+struct add_to_op
+{
+    template <typename EH, typename A, typename B>
+    static constexpr result_t<EH, explicit_or_common_integral_value_type<R, A, B>>
+    invoke(A a, B b)
+    {
+        return detail::add_to<EH, explicit_or_common_integral_value_type<R, A, B>>(a, b);
+    }
+};
+template <typename R>
+struct subtract_to_op
+{
+    template <typename EH, typename A, typename B>
+    static constexpr result_t<EH, explicit_or_common_integral_value_type<R, A, B>>
+    invoke(A a, B b)
+    {
+        return detail::subtract_to<EH, explicit_or_common_integral_value_type<R, A, B>>(a, b);
+    }
+};
+template <typename R>
+struct multiply_to_op
+{
+    template <typename EH, typename A, typename B>
+    static constexpr result_t<EH, explicit_or_common_integral_value_type<R, A, B>>
+    invoke(A a, B b)
+    {
+        return detail::multiply_to<EH, explicit_or_common_integral_value_type<R, A, B>>(a, b);
+    }
+};
+struct multiply_add_op
+{
+    template <typename EH, typename A, typename B, typename C>
+    static constexpr result_t<EH, common_integral_value_type<A, B, C>>
+    invoke(A a, B b, C c)
+    {
+        return detail::multiply_add<EH>(a, b, c);
+    }
+};
+struct multiply_subtract_op
+{
+    template <typename EH, typename A, typename B, typename C>
+    static constexpr result_t<EH, common_integral_value_type<A, B, C>>
+    invoke(A a, B b, C c)
+    {
+        return detail::multiply_subtract<EH>(a, b, c);
+    }
+};
+template <typename R>
+struct narrow_op
+{
+    template <typename EH, typename V>
+    static constexpr result_t<EH, R>
+    invoke(V v)
+    {
+        return detail::narrow<EH, R>(v);
+    }
+};
+struct absi_op
+{
+    template <typename EH, typename V>
+    static constexpr result_t<EH, integral_value_type<V>>
+    invoke(V v)
+    {
+        return detail::absi<EH>(v);
+    }
+};
+struct negate_op
+{
+    template <typename EH, typename V>
+    static constexpr result_t<EH, integral_value_type<V>>
+    invoke(V v)
+    {
+        return detail::negate<EH>(v);
+    }
+};
+struct divide_op
+{
+    template <typename EH, typename N, typename D>
+    static constexpr result_t<EH, common_integral_value_type<N, D>>
+    invoke(N n, D d)
+    {
+        return detail::divide<EH>(n, d);
+    }
+};
+struct modulo_op
+{
+    template <typename EH, typename N, typename D>
+    static constexpr result_t<EH, common_integral_value_type<N, D>>
+    invoke(N n, D d)
+    {
+        return detail::modulo<EH>(n, d);
+    }
+};
+struct divmod_op
+{
+    template <typename EH, typename N, typename D>
+    static constexpr result_t<EH, divmod_result<common_integral_value_type<N, D>>>
+    invoke(N n, D d)
+    {
+        return detail::divmod<EH>(n, d);
+    }
+};
+struct square_op
+{
+    template <typename EH, typename V>
+    static constexpr result_t<EH, integral_value_type<V>>
+    invoke(V v)
+    {
+        return detail::square<EH>(v);
+    }
+};
+struct shift_left_op
+{
+    template <typename EH, typename X, typename S>
+    static constexpr result_t<EH, integral_value_type<X>>
+    invoke(X x, S s)
+    {
+        return detail::shift_left<EH>(x, s);
+    }
+};
+struct shift_right_op
+{
+    template <typename EH, typename X, typename S>
+    static constexpr result_t<EH, integral_value_type<X>>
+    invoke(X x, S s)
+    {
+        return detail::shift_right<EH>(x, s);
+    }
+};
+struct powi_op
+{
+    template <typename EH, typename B, typename E>
+    static constexpr result_t<EH, integral_value_type<B>>
+    invoke(B b, E e)
+    {
+        return detail::powi<EH>(b, e);
+    }
+};
+struct modulo_euclid_op
+{
+    template <typename EH, typename N, typename D>
+    static constexpr result_t<EH, common_integral_value_type<N, D>>
+    invoke(N n, D d)
+    {
+        return EH::make_result(detail::modulo_euclid(n, d));
+    }
+};
+struct floori_op
+{
+    template <typename EH, typename X, typename D>
+    static constexpr result_t<EH, common_integral_value_type<X, D>>
+    invoke(X x, D d)
+    {
+        return detail::floori<EH>(x, d);
+    }
+};
+struct ceili_op
+{
+    template <typename EH, typename X, typename D>
+    static constexpr result_t<EH, common_integral_value_type<X, D>>
+    invoke(X x, D d)
+    {
+        return detail::ceili<EH>(x, d);
+    }
+};
+struct ratio_floori_op
+{
+    template <typename EH, typename N, typename D>
+    static constexpr result_t<EH, common_integral_value_type<N, D>>
+    invoke(N n, D d)
+    {
+        return detail::ratio_floori<EH>(n, d);
+    }
+};
+struct ratio_ceili_op
+{
+    template <typename EH, typename N, typename D>
+    static constexpr result_t<EH, common_integral_value_type<N, D>>
+    invoke(N n, D d)
+    {
+        return detail::ratio_ceili<EH>(n, d);
+    }
+};
+struct muldiv_floori_op
+{
+    template <typename EH, typename A, typename B, typename D>
+    static constexpr result_t<EH, common_integral_value_type<A, B, D>>
+    invoke(A a, B b, D d)
+    {
+        return detail::muldiv_floori<EH>(a, b, d);
+    }
+};
+struct muldiv_ceili_op
+{
+    template <typename EH, typename A, typename B, typename D>
+    static constexpr result_t<EH, common_integral_value_type<A, B, D>>
+    invoke(A a, B b, D d)
+    {
+        return detail::muldiv_ceili<EH>(a, b, d);
+    }
+};
+template <typename E>
+struct log_floori_op
+{
+    template <typename EH, typename X, typename B>
+    static constexpr result_t<EH, E>
+    invoke(X x, B b)
+    {
+        return EH::make_result(detail::log_floori<E>(x, b));
+    }
+};
+template <typename E>
+struct log_ceili_op
+{
+    template <typename EH, typename X, typename B>
+    static constexpr result_t<EH, E>
+    invoke(X x, B b)
+    {
+        return EH::make_result(detail::log_ceili<E>(x, b));
+    }
+};
+#if gsl_CPP17_OR_GREATER
+struct gcd_op
+{
+    template <typename EH, typename A, typename B>
+    static constexpr result_t<EH, common_integral_value_type<A, B>>
+    invoke(A a, B b)
+    {
+        return detail::gcd<EH>(a, b);
+    }
+};
+struct lcm_op
+{
+    template <typename EH, typename A, typename B>
+    static constexpr result_t<EH, common_integral_value_type<A, B>>
+    invoke(A a, B b)
+    {
+        return detail::lcm<EH>(a, b);
+    }
+};
+#endif // gsl_CPP17_OR_GREATER
+
+
+template <typename... Vs> using are_integral_constants = gsl::conjunction<is_integral_constant<Vs>...>;
+
+    // Evaluates the operation `F` for the `std::integral_constant<>` arguments `As...` at compile time.
+template <typename F, typename... As>
+struct constant_result_
+{
+    static constexpr auto result = F::template invoke<try_error_handler>(As::value...);
+    static_assert(result.ec == std::errc{ }, "integer overflow in operation on std::integral_constant<> arguments");
+
+    using type = std::integral_constant<decltype(result.value), result.value>;
+};
+
+    // `divmod()` returns the quotient and the remainder as `std::integral_constant<>` members of a `divmod_result<>`.
+template <typename N, typename D>
+struct constant_result_<divmod_op, N, D>
+{
+    static constexpr auto result = divmod_op::invoke<try_error_handler>(N::value, D::value);
+    static_assert(result.ec == std::errc{ }, "integer overflow in operation on std::integral_constant<> arguments");
+
+    using V = decltype(result.value.quotient);
+    using type = divmod_result<std::integral_constant<V, result.value.quotient>, std::integral_constant<V, result.value.remainder>>;
+};
+
+    // The result type of the operation `F` with the error handler `EH`, or the result of the operation as an `std::integral_constant<>`
+    // if all arguments are `std::integral_constant<>`. If `F` cannot be invoked with the given arguments, there is no result type, so
+    // the generic public functions drop out of overload resolution in favour of overloads for other argument types such as `divider<>`.
+template <typename EH, typename F, typename Void, typename... As> struct invoke_result_ { };
+template <typename EH, typename F, typename... As> struct invoke_result_<EH, F, decltype(void(F::template invoke<EH>(std::declval<As>()...))), As...> { using type = decltype(F::template invoke<EH>(std::declval<As>()...)); };
+template <typename EH, typename F, bool AreConstants, typename... As> struct result_or_constant_ : invoke_result_<EH, F, void, As...> { };
+template <typename EH, typename F, typename... As> struct result_or_constant_<EH, F, true, As...> : constant_result_<F, As...> { };
+template <typename EH, typename F, typename... As> using result_or_constant = typename result_or_constant_<EH, F, are_integral_constants<As...>::value, As...>::type;
+template <typename F, typename... As> using value_or_constant = result_or_constant<ignore_error_handler, F, As...>;
+
+template <typename EH, typename F, typename... As>
+constexpr auto
+evaluate_0(std::false_type /*areConstants*/, As... as)
+{
+    return F::template invoke<EH>(as...);
+}
+template <typename EH, typename F, typename... As>
+constexpr typename constant_result_<F, As...>::type
+evaluate_0(std::true_type /*areConstants*/, As...)
+{
+    return { };
+}
+template <typename EH, typename F, typename... As>
+constexpr auto
+evaluate(As... as)
+{
+    return detail::evaluate_0<EH, F>(are_integral_constants<As...>{ }, as...);
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_CONSTANT_HPP_
@@ -0,0 +1,226 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_DIVIDER_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_DIVIDER_HPP_
+
+
+#include <climits>      // for CHAR_BIT
+#include <type_traits>  // for integral_constant<>
+
+#include <slowmath/detail/type_traits.hpp>  // for is_signed_v<>, min_v<>, make_unsigned_t<>, common_integral_value_type<>, double_width_type<>, is_double_word<>, result_t<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK()
+#include <slowmath/detail/double-word.hpp>  // for double_word<>, divide_double_word()
+#include <slowmath/detail/extended.hpp>     // for multiply_extended()
+#include <slowmath/detail/pow-log.hpp>      // for bit_scan_reverse()
+#include <slowmath/detail/arithmetic.hpp>   // for magnitude(), is_negative(), can_divide_overflow<>
+#include <slowmath/detail/round.hpp>        // for floor_correction(), ceil_correction()
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4146) // unary minus operator applied to unsigned type, result still unsigned
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+
+template <typename V>
+class divider;
+template <typename Q, typename R = Q>
+struct divmod_result;
+
+
+namespace detail
+{
+
+
+    // Division by an invariant divisor d ∊ ℕ, d ≠ 0, with multiplication and shifting, cf. Granlund & Montgomery, "Division by
+    // Invariant Integers using Multiplication" (1994), Figure 4.1. With ℓ = ⌈log₂ d⌉ and the N-bit multiplier
+    //
+    //     m = ⌊2ᴺ ∙ (2ˡ - d) ÷ d⌋ + 1 ,
+    //
+    // the quotient is obtained as
+    //
+    //     t = ⌊m ∙ n ÷ 2ᴺ⌋ ,
+    //     ⌊n ÷ d⌋ = ⌊(t + ⌊(n - t) ÷ 2^s₁⌋) ÷ 2^s₂⌋    with s₁ = min(ℓ, 1), s₂ = max(ℓ - 1, 0) .
+    //
+    // This holds for every divisor, including d = 1 and powers of 2 (for which m = 1 and t = 0), so no branch is needed at the
+    // point of division. None of the intermediate values can overflow.
+template <typename U>
+struct reciprocal
+{
+    U multiplier;
+    unsigned char shift1;
+    unsigned char shift2;
+};
+
+    // Computes ⌊p ∙ 2ᴺ ÷ d⌋ for p < d.
+template <typename U>
+constexpr U
+divide_shifted_0(std::false_type /*isDoubleWord*/, U p, U d)
+{
+    using W = double_width_type<U>;
+
+    return U((W(p) << (sizeof(U) * CHAR_BIT)) / W(d));
+}
+template <typename U>
+constexpr U
+divide_shifted_0(std::true_type /*isDoubleWord*/, U p, U d)
+{
+    return detail::divide_double_word(double_word<U>{ p, 0 }, d).quotient;
+}
+
+template <typename U>
+constexpr reciprocal<U>
+make_reciprocal(U d)
+{
+    int l = d > 1 ? detail::bit_scan_reverse(U(d - 1)) + 1 : 0;
+
+        // 2ˡ - d is computed modulo 2ᴺ because 2ˡ is not representable for l = N.
+    U p = l > 0 ? U(U(U(2) << (l - 1)) - d) : U(0);
+    U m = U(detail::divide_shifted_0(is_double_word<double_width_type<U>>{ }, p, d) + 1);
+    return { m, static_cast<unsigned char>(l > 0 ? 1 : 0), static_cast<unsigned char>(l > 0 ? l - 1 : 0) };
+}
+
+    // Computes ⌊n ÷ d⌋ for n ∊ ℕ₀ with the reciprocal of d.
+template <typename U>
+constexpr U
+divide_by_reciprocal(U n, reciprocal<U> r)
+{
+    U t = detail::multiply_extended(n, r.multiplier).hi;
+    return U(U(t + U(U(n - t) >> r.shift1)) >> r.shift2);
+}
+
+
+    // For signed operands, the quotient of the magnitudes is computed with the reciprocal of |d| and then negated if n and d have
+    // different signs, which amounts to division with truncation towards zero. The magnitudes are representable by the unsigned type
+    // even for n = d = min_v<V>. The case n = min_v<V>, d = -1 is excluded by the precondition.
+    // This assumes a two's complement representation.
+template <typename V>
+constexpr V
+divide_by_reciprocal_0(std::false_type /*isSigned*/, V n, V, reciprocal<V> r)
+{
+    return detail::divide_by_reciprocal(n, r);
+}
+template <typename V>
+constexpr V
+divide_by_reciprocal_0(std::true_type /*isSigned*/, V n, V d, reciprocal<make_unsigned_t<V>> r)
+{
+    using U = make_unsigned_t<V>;
+
+    U q = detail::divide_by_reciprocal(detail::magnitude(n), r);
+    U negMask = U(U(0) - (U(n ^ d) >> (sizeof(V) * CHAR_BIT - 1)));
+    return V(U(U(q ^ negMask) - negMask));
+}
+
+    // Computes n ÷ d, truncated towards zero, for d ≠ 0 with the reciprocal of |d|.
+template <typename V>
+constexpr V
+divide_by_reciprocal(V n, V d, reciprocal<make_unsigned_t<V>> r)
+{
+    return detail::divide_by_reciprocal_0(std::integral_constant<bool, is_signed_v<V>>{ }, n, d, r);
+}
+
+
+struct divider_access
+{
+    template <typename V>
+    static constexpr reciprocal<make_unsigned_t<V>>
+    get_reciprocal(divider<V> const& d) noexcept
+    {
+        return d.reciprocal_;
+    }
+};
+
+
+    // Computes n ÷ d and n mod d for d ≠ 0 with a single division. Like `divide()`, this can only overflow for n = min_v<V> and d = -1.
+template <typename EH, typename N, typename D>
+constexpr result_t<EH, divmod_result<common_integral_value_type<N, D>>>
+divmod(N n, D d)
+{
+    using V = common_integral_value_type<N, D>;
+
+    if (can_divide_overflow<V, D>::value) // should be `if constexpr` in C++17
+    {
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(!(n == min_v<V> && d == -1));
+    }
+    return EH::make_result(divmod_result<V>{ V(n / d), V(n % d) });
+}
+
+
+    // The following functions compute the results of the respective operations with the precomputed reciprocal of the divisor.
+    // The quotient q = n ÷ d satisfies |q ∙ d| ≤ |n|, so the remainder n - q ∙ d can be computed without overflow.
+
+template <typename V>
+constexpr V
+divide(V n, divider<V> const& d)
+{
+    return detail::divide_by_reciprocal(n, d.divisor(), divider_access::get_reciprocal(d));
+}
+template <typename V>
+constexpr V
+modulo(V n, divider<V> const& d)
+{
+    V q = detail::divide(n, d);
+    return V(n - q*d.divisor());
+}
+template <typename V>
+constexpr divmod_result<V>
+divmod(V n, divider<V> const& d)
+{
+    V q = detail::divide(n, d);
+    return { q, V(n - q*d.divisor()) };
+}
+
+    // The rounding functions correct the truncated quotient and remainder as described in round.hpp.
+template <typename V>
+constexpr V
+floori(V x, divider<V> const& d)
+{
+    V r = detail::modulo(x, d);
+    return V(V(x - r) - (d.divisor() & -V(detail::is_negative(r))));
+}
+template <typename V>
+constexpr V
+ceili(V x, divider<V> const& d)
+{
+    V r = detail::modulo(x, d);
+    return V(V(x - r) + (d.divisor() & -V(r > 0)));
+}
+template <typename V>
+constexpr V
+ratio_floori(V n, divider<V> const& d)
+{
+    auto qr = detail::divmod(n, d);
+    return V(qr.quotient - detail::floor_correction(qr.remainder, d.divisor()));
+}
+template <typename V>
+constexpr V
+ratio_ceili(V n, divider<V> const& d)
+{
+    auto qr = detail::divmod(n, d);
+    return V(qr.quotient + detail::ceil_correction(qr.remainder, d.divisor())); // overflow-safe
+}
+template <typename V>
+constexpr V
+modulo_euclid(V n, divider<V> const& d)
+{
+    using U = make_unsigned_t<V>;
+
+    V r = detail::modulo(n, d);
+    return V(U(r) + (detail::magnitude(d.divisor()) & U(-U(detail::is_negative(r)))));
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_DIVIDER_HPP_
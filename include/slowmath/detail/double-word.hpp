@@ -0,0 +1,365 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_DOUBLE_WORD_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_DOUBLE_WORD_HPP_
+
+
+#include <climits>      // for CHAR_BIT
+#include <type_traits>  // for integral_constant<>
+
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, is_signed_v<>, make_signed_t<>, make_unsigned_t<>, wider_type<>, double_word<>, is_double_word<>
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // Represents the value hi ∙ 2ᴺ + lo, where N is the number of bits in V. `hi` is signed iff V is signed.
+template <typename V>
+struct double_word
+{
+    V hi;
+    make_unsigned_t<V> lo;
+};
+
+
+    // Computes the full-width product of a and b for unsigned a, b.
+template <typename U>
+constexpr double_word<U>
+multiply_double_word(U a, U b)
+{
+    constexpr int halfBits = sizeof(U) * CHAR_BIT / 2;
+    constexpr U halfMask = U(U(1) << halfBits) - 1;
+
+        // Schoolbook multiplication with half-words; none of the partial sums can overflow.
+    U a0 = a & halfMask, a1 = a >> halfBits;
+    U b0 = b & halfMask, b1 = b >> halfBits;
+    U p00 = a0 * b0;
+    U p01 = a0 * b1;
+    U p10 = a1 * b0;
+    U p11 = a1 * b1;
+    U mid = (p00 >> halfBits) + (p01 & halfMask) + (p10 & halfMask);
+    return {
+        U(p11 + (p01 >> halfBits) + (p10 >> halfBits) + (mid >> halfBits)),
+        U((mid << halfBits) | (p00 & halfMask))
+    };
+}
+
+
+template <typename U>
+struct quotient_remainder
+{
+    U quotient;
+    U remainder;
+};
+
+    // Computes ⌊n ÷ d⌋ and n mod d for unsigned n.hi < d, i.e. if the quotient is representable by U.
+template <typename U>
+constexpr quotient_remainder<U>
+divide_double_word(double_word<U> n, U d)
+{
+    constexpr int bits = sizeof(U) * CHAR_BIT;
+    constexpr int halfBits = bits / 2;
+    constexpr U b = U(U(1) << halfBits);
+    constexpr U halfMask = U(b - 1);
+
+        // Knuth's Algorithm D for two half-word digits, cf. `divlu()` in Hacker's Delight. The divisor is normalized such that its
+        // most significant bit is set, which ensures that the estimated quotient digits are off by at most 2.
+    int s = 0;
+    for (int shift = halfBits; shift > 0; shift /= 2)
+    {
+        if ((d >> (bits - shift)) == 0)
+        {
+            d = U(d << shift);
+            s += shift;
+        }
+    }
+    U un32 = s != 0 ? U((n.hi << s) | (n.lo >> (bits - s))) : n.hi;
+    U un10 = U(n.lo << s);
+    U vn1 = d >> halfBits, vn0 = d & halfMask;
+    U un1 = un10 >> halfBits, un0 = un10 & halfMask;
+
+    U q1 = un32 / vn1;
+    U rhat = U(un32 - q1*vn1);
+    while (q1 >= b || q1*vn0 > U(b*rhat + un1))
+    {
+        --q1;
+        rhat += vn1;
+        if (rhat >= b) break;
+    }
+    U un21 = U(un32*b + un1 - q1*d);
+
+    U q0 = un21 / vn1;
+    rhat = U(un21 - q0*vn1);
+    while (q0 >= b || q0*vn0 > U(b*rhat + un0))
+    {
+        --q0;
+        rhat += vn1;
+        if (rhat >= b) break;
+    }
+    return { U(q1*b + q0), U(U(un21*b + un0 - q0*d) >> s) };
+}
+
+
+    // The following functions implement the widening operations required by the narrow-type algorithms, either with a native
+    // wider type or with `double_word<>`.
+
+template <typename V, typename A>
+constexpr wider_type<V>
+widen_0(std::false_type /*isDoubleWord*/, A a)
+{
+    return wider_type<V>(a);
+}
+template <typename V, typename A>
+constexpr double_word<V>
+widen_0(std::true_type /*isDoubleWord*/, A a)
+{
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+        // This assumes a two's complement representation.
+    return { V(is_signed_v<V> && S(a) < 0 ? -1 : 0), U(a) };
+}
+template <typename V, typename A>
+constexpr wider_type<V>
+widen(A a)
+{
+    return detail::widen_0<V>(is_double_word<wider_type<V>>{ }, a);
+}
+
+template <typename V, typename A, typename B>
+constexpr wider_type<V>
+widening_add_0(std::false_type /*isDoubleWord*/, A a, B b)
+{
+    using W = wider_type<V>;
+
+    return W(W(a) + W(b));
+}
+template <typename V, typename A, typename B>
+constexpr double_word<V>
+widening_add_0(std::true_type /*isDoubleWord*/, A a, B b)
+{
+    using U = make_unsigned_t<V>;
+
+    auto wa = detail::widen_0<V>(std::true_type{ }, a);
+    auto wb = detail::widen_0<V>(std::true_type{ }, b);
+    U lo = U(wa.lo + wb.lo);
+    U carry = lo < wa.lo ? 1 : 0;
+    return { V(U(U(wa.hi) + U(wb.hi) + carry)), lo };
+}
+template <typename V, typename A, typename B>
+constexpr wider_type<V>
+widening_add(A a, B b)
+{
+    return detail::widening_add_0<V>(is_double_word<wider_type<V>>{ }, a, b);
+}
+
+template <typename V, typename A, typename B>
+constexpr wider_type<V>
+widening_multiply_0(std::false_type /*isDoubleWord*/, A a, B b)
+{
+    using W = wider_type<V>;
+
+    return W(W(a) * W(b));
+}
+template <typename V, typename A, typename B>
+constexpr double_word<V>
+widening_multiply_0(std::true_type /*isDoubleWord*/, A a, B b)
+{
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+    auto product = detail::multiply_double_word(U(a), U(b));
+    U hi = product.hi;
+    if (is_signed_v<V>) // should be `if constexpr` in C++17
+    {
+            // Correct the high word of the unsigned product for negative operands:
+            //
+            //     a ∙ b = (a + 2ᴺ) ∙ (b + 2ᴺ) - 2ᴺ ∙ a - 2ᴺ ∙ b - 2²ᴺ
+            //
+            // The corrections are applied with masks rather than branches so that loops calling this function can be vectorized.
+            // This assumes a two's complement representation.
+        hi -= U(b) & U(U(0) - U(S(a) < 0));
+        hi -= U(a) & U(U(0) - U(S(b) < 0));
+    }
+    return { V(hi), product.lo };
+}
+template <typename V, typename A, typename B>
+constexpr wider_type<V>
+widening_multiply(A a, B b)
+{
+    return detail::widening_multiply_0<V>(is_double_word<wider_type<V>>{ }, a, b);
+}
+
+    // Computes a ∙ b ± c in the wider type. Neither the product nor the sum or difference can overflow the wider type.
+template <typename V, typename A, typename B, typename C>
+constexpr wider_type<V>
+widening_multiply_add_0(std::false_type /*isDoubleWord*/, A a, B b, C c)
+{
+    using W = wider_type<V>;
+
+    return W(W(a) * W(b) + W(c));
+}
+template <typename V, typename A, typename B, typename C>
+constexpr double_word<V>
+widening_multiply_add_0(std::true_type /*isDoubleWord*/, A a, B b, C c)
+{
+    using U = make_unsigned_t<V>;
+
+    auto product = detail::widening_multiply_0<V>(std::true_type{ }, a, b);
+    auto wc = detail::widen_0<V>(std::true_type{ }, c);
+    U lo = U(product.lo + wc.lo);
+    U carry = lo < product.lo ? 1 : 0;
+    return { V(U(U(product.hi) + U(wc.hi) + carry)), lo };
+}
+template <typename V, typename A, typename B, typename C>
+constexpr wider_type<V>
+widening_multiply_add(A a, B b, C c)
+{
+    return detail::widening_multiply_add_0<V>(is_double_word<wider_type<V>>{ }, a, b, c);
+}
+
+template <typename V, typename A, typename B, typename C>
+constexpr wider_type<V>
+widening_multiply_subtract_0(std::false_type /*isDoubleWord*/, A a, B b, C c)
+{
+    using W = wider_type<V>;
+
+    return W(W(a) * W(b) - W(c));
+}
+template <typename V, typename A, typename B, typename C>
+constexpr double_word<V>
+widening_multiply_subtract_0(std::true_type /*isDoubleWord*/, A a, B b, C c)
+{
+    using U = make_unsigned_t<V>;
+
+    auto product = detail::widening_multiply_0<V>(std::true_type{ }, a, b);
+    auto wc = detail::widen_0<V>(std::true_type{ }, c);
+    U lo = U(product.lo - wc.lo);
+    U borrow = product.lo < wc.lo ? 1 : 0;
+    return { V(U(U(product.hi) - U(wc.hi) - borrow)), lo };
+}
+template <typename V, typename A, typename B, typename C>
+constexpr wider_type<V>
+widening_multiply_subtract(A a, B b, C c)
+{
+    return detail::widening_multiply_subtract_0<V>(is_double_word<wider_type<V>>{ }, a, b, c);
+}
+
+    // Returns whether the value w of the wider type is representable by V.
+template <typename V, typename W>
+constexpr bool
+fits_0(std::false_type /*isDoubleWord*/, W w)
+{
+    using UV = make_unsigned_t<V>;
+    using UW = make_unsigned_t<W>;
+
+        // This assumes a two's complement representation.
+    return UW(w - W(min_v<V>)) <= max_v<UV>;
+}
+template <typename V, typename W>
+constexpr bool
+fits_0(std::true_type /*isDoubleWord*/, W w)
+{
+    using S = make_signed_t<V>;
+
+        // This assumes a two's complement representation.
+    return w.hi == V(is_signed_v<V> && S(w.lo) < 0 ? -1 : 0);
+}
+template <typename V, typename W>
+constexpr bool
+fits(W w)
+{
+    return detail::fits_0<V>(is_double_word<W>{ }, w);
+}
+
+    // Converts the value w of the wider type to V, discarding high bits.
+template <typename V, typename W>
+constexpr V
+truncate_0(std::false_type /*isDoubleWord*/, W w)
+{
+    return V(w);
+}
+template <typename V, typename W>
+constexpr V
+truncate_0(std::true_type /*isDoubleWord*/, W w)
+{
+    return V(w.lo);
+}
+template <typename V, typename W>
+constexpr V
+truncate(W w)
+{
+    return detail::truncate_0<V>(is_double_word<W>{ }, w);
+}
+
+    // Returns the high word of the value w of the wider type.
+template <typename V, typename W>
+constexpr V
+high_word_0(std::false_type /*isDoubleWord*/, W w)
+{
+    return V(w >> (sizeof(V) * CHAR_BIT));
+}
+template <typename V, typename W>
+constexpr V
+high_word_0(std::true_type /*isDoubleWord*/, W w)
+{
+    return w.hi;
+}
+template <typename V, typename W>
+constexpr V
+high_word(W w)
+{
+    return detail::high_word_0<V>(is_double_word<W>{ }, w);
+}
+
+
+    // Converts the value w of the wider type to V, clamping it to the range of V.
+template <typename V, typename W>
+constexpr V
+saturate_0(std::false_type /*isDoubleWord*/, W w)
+{
+    using SW = make_signed_t<W>;
+
+        // cast to signed to avoid warning about pointless unsigned comparison
+    return is_signed_v<V> && SW(w) < SW(min_v<V>) ? min_v<V>
+         : w > W(max_v<V>) ? max_v<V>
+         : V(w);
+}
+template <typename V, typename W>
+constexpr V
+saturate_0(std::true_type /*isDoubleWord*/, W w)
+{
+    using S = make_signed_t<V>;
+
+    return detail::fits_0<V>(std::true_type{ }, w) ? V(w.lo)
+         : is_signed_v<V> && S(w.hi) < 0 ? min_v<V>
+         : max_v<V>;
+}
+template <typename V, typename W>
+constexpr V
+saturate(W w)
+{
+    return detail::saturate_0<V>(is_double_word<W>{ }, w);
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_DOUBLE_WORD_HPP_
@@ -4,11 +4,18 @@
 
 
 #include <cerrno>
+#include <cstdlib>       // for abort()
 #include <exception>     // for terminate()
 #include <type_traits>   // for integral_constant<>
 #include <system_error>  // for errc, system_error, error_code, generic_category
 
-#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_AssertDebeug(), gsl_HAVE_EXCEPTIONS
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_AssertDebeug(), gsl_NORETURN, gsl_HAVE_EXCEPTIONS, gsl_CPP20_OR_GREATER
+
+#if defined(_MSC_VER)
+# include <intrin.h>  // for __ud2()
+#endif // defined(_MSC_VER)
+
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -27,6 +34,56 @@
 # define SLOWMATH_DETAIL_FORCEINLINE  inline
 #endif
 
+#if defined(__CUDA_ARCH__) && defined(__NVCC__)
+# define SLOWMATH_DETAIL_TRAP()  __trap()
+#elif defined(__GNUC__) || defined(__clang__)
+# define SLOWMATH_DETAIL_TRAP()  __builtin_trap()
+#elif defined(_MSC_VER)
+# define SLOWMATH_DETAIL_TRAP()  __ud2()
+#else
+# define SLOWMATH_DETAIL_TRAP()  std::abort()
+#endif
+
+    // Error paths are routed through functions which are never inlined and which are placed in a separate text section where
+    // supported, and the overflow checks are marked as unlikely, so that the code for raising errors does not bloat the hot path.
+#if defined(__GNUC__) || defined(__clang__)
+# define SLOWMATH_DETAIL_NOINLINE_COLD  __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+# define SLOWMATH_DETAIL_NOINLINE_COLD  __declspec(noinline)
+#else
+# define SLOWMATH_DETAIL_NOINLINE_COLD
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+# define SLOWMATH_DETAIL_UNLIKELY(condition)  __builtin_expect(!!(condition), 0)
+#else
+# define SLOWMATH_DETAIL_UNLIKELY(condition)  (condition)
+#endif
+
+#if gsl_CPP20_OR_GREATER
+# define SLOWMATH_DETAIL_UNLIKELY_BRANCH  [[unlikely]]
+#else
+# define SLOWMATH_DETAIL_UNLIKELY_BRANCH
+#endif
+
+    // Lets the optimizer assume that a condition holds. The behavior is undefined if it does not.
+#if defined(__has_cpp_attribute) && __cplusplus > 202002L
+# if __has_cpp_attribute(assume) >= 202207L
+#  define SLOWMATH_DETAIL_ASSUME(condition)  [[assume(condition)]]
+# endif
+#endif
+#if !defined(SLOWMATH_DETAIL_ASSUME)
+# if defined(__clang__)
+#  define SLOWMATH_DETAIL_ASSUME(condition)  __builtin_assume(condition)
+# elif defined(__GNUC__)
+#  define SLOWMATH_DETAIL_ASSUME(condition)  (!(condition) ? __builtin_unreachable() : (void) 0)
+# elif defined(_MSC_VER)
+#  define SLOWMATH_DETAIL_ASSUME(condition)  __assume(condition)
+# else
+#  define SLOWMATH_DETAIL_ASSUME(condition)  ((void) 0)
+# endif
+#endif
+
 
 namespace slowmath
 {
@@ -36,11 +93,134 @@ template <typename T>
 struct arithmetic_result;
 
 
+    //
+    // Identifies the operation which raised an `overflow_error`.
+    //
+enum class arithmetic_operation : unsigned char
+{
+    unspecified,
+    absi,
+    negate,
+    add,
+    subtract,
+    multiply,
+    multiply_add,
+    multiply_subtract,
+    divide,
+    modulo,
+    narrow,
+    square,
+    shift_left,
+    shift_right,
+    powi,
+    floori,
+    ceili,
+    ratio_floori,
+    ratio_ceili,
+    muldiv_floori,
+    muldiv_ceili,
+    factorize_ceili,
+    gcd,
+    lcm,
+    sum,
+    product,
+    dot,
+    exclusive_scan,
+    inclusive_scan
+};
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // The exception thrown by the `*_checked()` operations and by `throw_error_handler` upon overflow.
+    //ᅟ
+    // `overflow_error` is a `std::system_error` with error code `std::errc::value_too_large`. Unlike `std::system_error`, it
+    // is constructed without formatting a message: `what()` returns a static string, and the `std::system_error` base is
+    // copied from a prototype object constructed once. With libstdc++ and libc++, whose exception messages are reference-
+    // counted, throwing an `overflow_error` therefore does not allocate memory other than the exception object itself.
+    //
+class overflow_error : public std::system_error
+{
+private:
+    arithmetic_operation operation_;
+
+    static std::system_error const&
+    prototype()
+    {
+        static std::system_error const e(std::make_error_code(std::errc::value_too_large));
+        return e;
+    }
+
+public:
+    explicit overflow_error(arithmetic_operation op = arithmetic_operation::unspecified)
+        : std::system_error(prototype()), operation_(op)
+    {
+    }
+
+        // The operation which overflowed, or `arithmetic_operation::unspecified` if it is not known.
+    arithmetic_operation
+    operation() const noexcept
+    {
+        return operation_;
+    }
+
+    char const*
+    what() const noexcept override
+    {
+        switch (operation_)
+        {
+        case arithmetic_operation::absi:              return "integer overflow in absi()";
+        case arithmetic_operation::negate:            return "integer overflow in negate()";
+        case arithmetic_operation::add:               return "integer overflow in add()";
+        case arithmetic_operation::subtract:          return "integer overflow in subtract()";
+        case arithmetic_operation::multiply:          return "integer overflow in multiply()";
+        case arithmetic_operation::multiply_add:      return "integer overflow in multiply_add()";
+        case arithmetic_operation::multiply_subtract: return "integer overflow in multiply_subtract()";
+        case arithmetic_operation::divide:            return "integer overflow in divide()";
+        case arithmetic_operation::modulo:            return "integer overflow in modulo()";
+        case arithmetic_operation::narrow:            return "integer overflow in narrow()";
+        case arithmetic_operation::square:            return "integer overflow in square()";
+        case arithmetic_operation::shift_left:        return "integer overflow in shift_left()";
+        case arithmetic_operation::shift_right:       return "integer overflow in shift_right()";
+        case arithmetic_operation::powi:              return "integer overflow in powi()";
+        case arithmetic_operation::floori:            return "integer overflow in floori()";
+        case arithmetic_operation::ceili:             return "integer overflow in ceili()";
+        case arithmetic_operation::ratio_floori:      return "integer overflow in ratio_floori()";
+        case arithmetic_operation::ratio_ceili:       return "integer overflow in ratio_ceili()";
+        case arithmetic_operation::muldiv_floori:     return "integer overflow in muldiv_floori()";
+        case arithmetic_operation::muldiv_ceili:      return "integer overflow in muldiv_ceili()";
+        case arithmetic_operation::factorize_ceili:   return "integer overflow in factorize_ceili()";
+        case arithmetic_operation::gcd:               return "integer overflow in gcd()";
+        case arithmetic_operation::lcm:               return "integer overflow in lcm()";
+        case arithmetic_operation::sum:               return "integer overflow in sum()";
+        case arithmetic_operation::product:           return "integer overflow in product()";
+        case arithmetic_operation::dot:               return "integer overflow in dot()";
+        case arithmetic_operation::exclusive_scan:    return "integer overflow in exclusive_scan()";
+        case arithmetic_operation::inclusive_scan:    return "integer overflow in inclusive_scan()";
+        default:                                      return "integer overflow";
+        }
+    }
+};
+#endif // gsl_HAVE_EXCEPTIONS
+
+
 namespace detail
 {
 
 
-[[noreturn]] inline void
+#if gsl_HAVE_EXCEPTIONS
+[[noreturn]] SLOWMATH_DETAIL_NOINLINE_COLD inline void
+throw_system_error(std::errc ec)
+{
+    throw std::system_error(std::make_error_code(ec));
+}
+
+[[noreturn]] SLOWMATH_DETAIL_NOINLINE_COLD inline void
+throw_overflow_error(arithmetic_operation operation)
+{
+    throw overflow_error(operation);
+}
+
+[[noreturn]] SLOWMATH_DETAIL_NOINLINE_COLD inline void
 posix_raise(int errorCode)
 {
     throw std::system_error(std::error_code(errorCode, std::generic_category()));
@@ -55,14 +235,15 @@ posix_raise_last_error(void)
 inline void
 posix_check(int errorCode)
 {
-    if (errorCode != 0) detail::posix_raise(errorCode);
+    if (SLOWMATH_DETAIL_UNLIKELY(errorCode != 0)) detail::posix_raise(errorCode);
 }
 
 inline void
 posix_assert(bool success)
 {
-    if (!success) detail::posix_raise_last_error();
+    if (SLOWMATH_DETAIL_UNLIKELY(!success)) detail::posix_raise_last_error();
 }
+#endif // gsl_HAVE_EXCEPTIONS
 
 
 struct unreachable_wildcard_t
@@ -89,6 +270,96 @@ struct errc_wildcard_t
     }
 };
 
+    // Converts to the smallest or largest value representable by the result type.
+struct saturation_wildcard_t
+{
+    bool negative;
+
+    template <typename T>
+    constexpr
+    operator T(void) const noexcept
+    {
+        return negative ? min_v<T> : max_v<T>;
+    }
+};
+
+
+#if gsl_HAVE_EXCEPTIONS
+    // Throws `overflow_error` upon overflow, or `std::system_error` for other errors. The `*_checked()` operations use this
+    // error handler to record which operation overflowed; the public `throw_error_handler` reports the operation as unspecified.
+template <arithmetic_operation Operation>
+struct operation_throw_error_handler
+{
+    template <typename T> using result = T;
+
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE T
+    make_result(T value) noexcept
+    {
+        return value;
+    }
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE bool
+    check(bool condition) noexcept
+    {
+        return condition;
+    }
+    gsl_NORETURN static inline unreachable_wildcard_t
+    make_error(std::errc ec)
+    {
+        if (ec == std::errc::value_too_large) detail::throw_overflow_error(Operation);
+        detail::throw_system_error(ec);
+    }
+    gsl_NORETURN static inline unreachable_wildcard_t
+    make_overflow_error(bool /*negative*/)
+    {
+        detail::throw_overflow_error(Operation);
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE T
+    get_value(T result) noexcept
+    {
+        return result;
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE std::false_type
+    is_error(T) noexcept
+    {
+        return { };
+    }
+    template <typename T>
+    static SLOWMATH_DETAIL_FORCEINLINE unreachable_wildcard_t
+    passthrough_error(T) noexcept
+    {
+        std::terminate();
+    }
+};
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+} // namespace detail
+
+
+    //
+    // An error handler determines how the operations called with it report errors such as overflow. The unsuffixed operations
+    // (e.g. `absi()`, `divide()`) and the generic entry points (e.g. `add<EH>()`) take the error handler as a template parameter.
+    // Custom error handlers can be defined; an error handler `EH` is a class type with the following static members:
+    //
+    //     template <typename T> using result = ...;   // the result type of an operation whose result has value type T
+    //     make_result(T value)                       // wraps the result value of a successful operation in a `result<T>`
+    //     check(bool condition)                      // returns a value convertible to `bool` which is `false` iff `condition` is
+    //                                                // `false` and the error is to be raised with `make_error()`
+    //     make_error(std::errc ec)                   // returns an object convertible to `result<T>` for any T, or does not return
+    //     make_overflow_error(bool negative)         // like `make_error(std::errc::value_too_large)`; `negative` indicates
+    //                                                // whether the infinitely precise result is negative
+    //     get_value(result<T> r)                     // the value of a successful result
+    //     is_error(result<T> r)                      // whether `r` holds an error
+    //     passthrough_error(result<T> r)             // converts the error held by `r` to an object convertible to `result<U>`
+    //
+    // The last three members are used by algorithms which propagate errors raised by intermediate operations. All members except
+    // `make_error()`, `make_overflow_error()`, and `passthrough_error()` must be usable in constant expressions.
+    //
+
+    // Does not check for overflow; the caller must ensure that no overflow occurs.
 struct ignore_error_handler
 {
     template <typename T> using result = T;
@@ -104,11 +375,16 @@ struct ignore_error_handler
     {
         return { };
     }
-    static inline unreachable_wildcard_t
+    static inline detail::unreachable_wildcard_t
     make_error(std::errc)
     {
         std::terminate();
     }
+    static inline detail::unreachable_wildcard_t
+    make_overflow_error(bool /*negative*/)
+    {
+        std::terminate();
+    }
     template <typename T>
     static constexpr SLOWMATH_DETAIL_FORCEINLINE T
     get_value(T result) noexcept
@@ -122,13 +398,66 @@ struct ignore_error_handler
         return { };
     }
     template <typename T>
-    static SLOWMATH_DETAIL_FORCEINLINE unreachable_wildcard_t
+    static SLOWMATH_DETAIL_FORCEINLINE detail::unreachable_wildcard_t
     passthrough_error(T)
     {
         gsl_Expects(false);
     }
 };
 
+    // The caller must ensure that no overflow occurs. If `NDEBUG` is defined, the optimizer may assume the absence of overflow and
+    // use it to simplify subsequent code; otherwise, `gsl_Assert()` is used to check that no overflow occurs.
+struct assume_error_handler
+{
+    template <typename T> using result = T;
+
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE T
+    make_result(T value) noexcept
+    {
+        return value;
+    }
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE std::true_type
+    check(bool condition)
+    {
+#ifdef NDEBUG
+        SLOWMATH_DETAIL_ASSUME(condition);
+#else // NDEBUG
+        gsl_Assert(condition);
+#endif // NDEBUG
+        return { };
+    }
+    static inline detail::unreachable_wildcard_t
+    make_error(std::errc)
+    {
+        std::terminate();
+    }
+    static inline detail::unreachable_wildcard_t
+    make_overflow_error(bool /*negative*/)
+    {
+        std::terminate();
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE T
+    get_value(T result) noexcept
+    {
+        return result;
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE std::false_type
+    is_error(T) noexcept
+    {
+        return { };
+    }
+    template <typename T>
+    static SLOWMATH_DETAIL_FORCEINLINE detail::unreachable_wildcard_t
+    passthrough_error(T)
+    {
+        std::terminate();
+    }
+};
+
+    // Uses `gsl_Assert()` to check that no overflow occurs.
 struct failfast_error_handler
 {
     template <typename T> using result = T;
@@ -145,11 +474,16 @@ struct failfast_error_handler
         gsl_Assert(condition);
         return { };
     }
-    static inline unreachable_wildcard_t
+    static inline detail::unreachable_wildcard_t
     make_error(std::errc)
     {
         std::terminate();
     }
+    static inline detail::unreachable_wildcard_t
+    make_overflow_error(bool /*negative*/)
+    {
+        std::terminate();
+    }
     template <typename T>
     static constexpr SLOWMATH_DETAIL_FORCEINLINE T
     get_value(T result) noexcept
@@ -163,13 +497,14 @@ struct failfast_error_handler
         return { };
     }
     template <typename T>
-    static SLOWMATH_DETAIL_FORCEINLINE unreachable_wildcard_t
+    static SLOWMATH_DETAIL_FORCEINLINE detail::unreachable_wildcard_t
     passthrough_error(T)
     {
         std::terminate();
     }
 };
 
+    // Returns an `arithmetic_result<>` which holds either the result or the error code.
 struct try_error_handler
 {
     template <typename T> using result = arithmetic_result<T>;
@@ -185,11 +520,16 @@ struct try_error_handler
     {
         return condition;
     }
-    static constexpr errc_wildcard_t
+    static constexpr detail::errc_wildcard_t
     make_error(std::errc ec) noexcept
     {
         return { ec };
     }
+    static constexpr detail::errc_wildcard_t
+    make_overflow_error(bool /*negative*/) noexcept
+    {
+        return { std::errc::value_too_large };
+    }
     template <typename T>
     static constexpr SLOWMATH_DETAIL_FORCEINLINE T
     get_value(arithmetic_result<T> const& result) noexcept
@@ -203,7 +543,7 @@ struct try_error_handler
         return result.ec != std::errc{ };
     }
     template <typename T>
-    static constexpr SLOWMATH_DETAIL_FORCEINLINE errc_wildcard_t
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE detail::errc_wildcard_t
     passthrough_error(arithmetic_result<T> const& result) noexcept
     {
         return { result.ec };
@@ -211,7 +551,15 @@ struct try_error_handler
 };
 
 #if gsl_HAVE_EXCEPTIONS
-struct throw_error_handler
+    // Throws `overflow_error` upon overflow.
+struct throw_error_handler : detail::operation_throw_error_handler<arithmetic_operation::unspecified>
+{
+};
+#endif // gsl_HAVE_EXCEPTIONS
+
+    // Traps upon overflow. The trap compiles to a single instruction (e.g. `ud2` on x86) and is suitable for binaries which
+    // are built without exception support and for which the code size of the error path matters.
+struct trap_error_handler
 {
     template <typename T> using result = T;
 
@@ -226,10 +574,88 @@ struct throw_error_handler
     {
         return condition;
     }
-    gsl_NORETURN static inline unreachable_wildcard_t
-    make_error(std::errc ec)
+    gsl_NORETURN static inline detail::unreachable_wildcard_t
+    make_error(std::errc) noexcept
+    {
+        SLOWMATH_DETAIL_TRAP();
+    }
+    gsl_NORETURN static inline detail::unreachable_wildcard_t
+    make_overflow_error(bool /*negative*/) noexcept
+    {
+        SLOWMATH_DETAIL_TRAP();
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE T
+    get_value(T result) noexcept
+    {
+        return result;
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE std::false_type
+    is_error(T) noexcept
     {
-        throw std::system_error(std::make_error_code(ec));
+        return { };
+    }
+    template <typename T>
+    static SLOWMATH_DETAIL_FORCEINLINE detail::unreachable_wildcard_t
+    passthrough_error(T) noexcept
+    {
+        std::terminate();
+    }
+};
+
+
+    // The error handler used by the unsuffixed operations. It can be chosen for an entire binary by defining the macro
+    // `SLOWMATH_DEFAULT_ERROR_HANDLER` as one of the error handlers above, or as a custom error handler declared before any
+    // *slowmath* header is included. The default is `ignore_error_handler`.
+#ifndef SLOWMATH_DEFAULT_ERROR_HANDLER
+# define SLOWMATH_DEFAULT_ERROR_HANDLER ::slowmath::ignore_error_handler
+#endif // SLOWMATH_DEFAULT_ERROR_HANDLER
+using default_error_handler = SLOWMATH_DEFAULT_ERROR_HANDLER;
+
+
+namespace detail
+{
+
+
+using slowmath::ignore_error_handler;
+using slowmath::assume_error_handler;
+using slowmath::failfast_error_handler;
+using slowmath::try_error_handler;
+#if gsl_HAVE_EXCEPTIONS
+using slowmath::throw_error_handler;
+#endif // gsl_HAVE_EXCEPTIONS
+using slowmath::trap_error_handler;
+
+
+    // Clamps the result to the range of the result type. Error handling is deferred to the algorithm: an overflow check reported
+    // with `SLOWMATH_DETAIL_OVERFLOW_CHECK()` saturates to the largest representable value, hence algorithms whose results may
+    // overflow towards the smallest representable value must use `SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK()` instead. Because not
+    // all algorithms do, this error handler is not public; the saturating operations are provided as `*_saturating()` functions.
+struct saturate_error_handler
+{
+    template <typename T> using result = T;
+
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE T
+    make_result(T value) noexcept
+    {
+        return value;
+    }
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE bool
+    check(bool condition) noexcept
+    {
+        return condition;
+    }
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE saturation_wildcard_t
+    make_error(std::errc) noexcept
+    {
+        return { false };
+    }
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE saturation_wildcard_t
+    make_overflow_error(bool negative) noexcept
+    {
+        return { negative };
     }
     template <typename T>
     static constexpr SLOWMATH_DETAIL_FORCEINLINE T
@@ -250,11 +676,66 @@ struct throw_error_handler
         std::terminate();
     }
 };
+
+
+
+    // The result of an operation modulo 2ᴺ along with a flag which indicates whether the infinitely precise result is not
+    // representable. Unlike the error handlers above, the wrapping operations which return it never branch on the overflow
+    // condition; error handling is deferred to `overflow_accumulator`.
+template <typename V>
+struct wrapping_result
+{
+    V value;
+    bool overflow;
+};
+
+
+    // The `try_*()` and `*_checked()` operations in <slowmath/arithmetic.hpp> pass their results through `record_try_result()`
+    // and `checked_result<>()`, which by default return their argument unchanged. If the macro `SLOWMATH_OVERFLOW_TELEMETRY` is
+    // defined as 1 before any *slowmath* header is included, these operations take the source location of the call as a defaulted
+    // trailing argument, and the `*_checked()` operations compute their result with `try_error_handler`. The overloads of
+    // `record_try_result()` and `checked_result<>()` in detail/telemetry.hpp then record an overflow event for the source
+    // location on the error path before they return or throw the error.
+#ifndef SLOWMATH_OVERFLOW_TELEMETRY
+# define SLOWMATH_OVERFLOW_TELEMETRY 0
+#endif // SLOWMATH_OVERFLOW_TELEMETRY
+#if SLOWMATH_OVERFLOW_TELEMETRY
+# define SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER  , ::slowmath::detail::source_location site_ = ::slowmath::detail::source_location::current()
+# define SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT   , site_
+#else // SLOWMATH_OVERFLOW_TELEMETRY
+# define SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER
+# define SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT
+#endif // SLOWMATH_OVERFLOW_TELEMETRY
+
+template <typename T>
+constexpr SLOWMATH_DETAIL_FORCEINLINE T
+record_try_result(T result) noexcept
+{
+    return result;
+}
+
+#if gsl_HAVE_EXCEPTIONS
+# if SLOWMATH_OVERFLOW_TELEMETRY
+template <arithmetic_operation Operation> using checked_error_handler = try_error_handler;
+# else // SLOWMATH_OVERFLOW_TELEMETRY
+template <arithmetic_operation Operation> using checked_error_handler = operation_throw_error_handler<Operation>;
+# endif // SLOWMATH_OVERFLOW_TELEMETRY
+
+template <arithmetic_operation Operation, typename T>
+constexpr SLOWMATH_DETAIL_FORCEINLINE T
+checked_result(T result) noexcept
+{
+    return result;
+}
 #endif // gsl_HAVE_EXCEPTIONS
 
 
     // This macro is nasty but makes the code much more readable.
-#define SLOWMATH_DETAIL_OVERFLOW_CHECK(...) if (!EH::check(__VA_ARGS__)) return EH::make_error(std::errc::value_too_large)
+#define SLOWMATH_DETAIL_OVERFLOW_CHECK(...) if (SLOWMATH_DETAIL_UNLIKELY(!EH::check(__VA_ARGS__))) SLOWMATH_DETAIL_UNLIKELY_BRANCH return EH::make_error(std::errc::value_too_large)
+
+    // Like `SLOWMATH_DETAIL_OVERFLOW_CHECK()`, but also passes whether the infinitely precise result is negative, which allows
+    // `saturate_error_handler` to saturate towards the correct bound.
+#define SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(condition, negative) if (SLOWMATH_DETAIL_UNLIKELY(!EH::check(condition))) SLOWMATH_DETAIL_UNLIKELY_BRANCH return EH::make_overflow_error(negative)
 
 
 } // namespace detail
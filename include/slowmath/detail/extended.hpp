@@ -0,0 +1,118 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_EXTENDED_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_EXTENDED_HPP_
+
+
+#include <climits>      // for CHAR_BIT
+#include <cstdint>      // for uint64_t
+#include <type_traits>  // for integral_constant<>
+
+#include <slowmath/detail/type_traits.hpp>  // for is_signed_v<>, make_unsigned_t<>, common_integral_value_type<>, double_width_type<>, is_double_word<>
+#include <slowmath/detail/intrinsics.hpp>   // for is_constant_evaluated(), add_with_carry_u64(), subtract_with_borrow_u64(), multiply_extended_64()
+#include <slowmath/detail/double-word.hpp>  // for widening_multiply_0()
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+
+template <typename V>
+struct extended_product;
+template <typename V>
+struct carry_result;
+
+
+namespace detail
+{
+
+
+    // Computes the full-width product of a and b in the double-width type and splits it into high and low word.
+template <typename V>
+constexpr extended_product<V>
+multiply_extended_0(std::false_type /*isDoubleWord*/, V a, V b)
+{
+    using W = double_width_type<V>;
+    using U = make_unsigned_t<V>;
+    using UW = make_unsigned_t<W>;
+
+    W product = W(W(a) * W(b));
+    return { V(U(UW(product) >> (sizeof(V) * CHAR_BIT))), U(product) };
+}
+template <typename V>
+constexpr extended_product<V>
+multiply_extended_0(std::true_type /*isDoubleWord*/, V a, V b)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_MULTIPLY_EXTENDED_INTRINSICS)
+    if (sizeof(V) == sizeof(std::uint64_t) && !detail::is_constant_evaluated())
+    {
+        make_unsigned_t<V> lo = 0;
+        V hi = detail::multiply_extended_64(a, b, lo);
+        return { hi, lo };
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_MULTIPLY_EXTENDED_INTRINSICS)
+    auto product = detail::widening_multiply_0<V>(std::true_type{ }, a, b);
+    return { product.hi, product.lo };
+}
+template <typename A, typename B>
+constexpr extended_product<common_integral_value_type<A, B>>
+multiply_extended(A a, B b)
+{
+    using V = common_integral_value_type<A, B>;
+
+    return detail::multiply_extended_0<V>(is_double_word<double_width_type<V>>{ }, V(a), V(b));
+}
+
+    // Computes a + b + carryIn and a - b - borrowIn for unsigned a, b and returns the carry or borrow.
+template <typename U>
+constexpr carry_result<U>
+add_with_carry(U a, U b, bool carryIn)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS)
+    if (sizeof(U) == sizeof(std::uint64_t) && !detail::is_constant_evaluated())
+    {
+        U sum = 0;
+        bool carryOut = detail::add_with_carry_u64(a, b, carryIn, sum);
+        return { sum, carryOut };
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS)
+        // At most one of the two partial sums can wrap around.
+    U partial = U(a + b);
+    U sum = U(partial + U(carryIn));
+    return { sum, partial < a || sum < partial };
+}
+template <typename U>
+constexpr carry_result<U>
+subtract_with_borrow(U a, U b, bool borrowIn)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS)
+    if (sizeof(U) == sizeof(std::uint64_t) && !detail::is_constant_evaluated())
+    {
+        U difference = 0;
+        bool borrowOut = detail::subtract_with_borrow_u64(a, b, borrowIn, difference);
+        return { difference, borrowOut };
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS)
+        // At most one of the two partial differences can wrap around.
+    U partial = U(a - b);
+    U difference = U(partial - U(borrowIn));
+    return { difference, a < b || partial < U(borrowIn) };
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_EXTENDED_HPP_
@@ -4,7 +4,7 @@
 
 
 #include <slowmath/detail/arithmetic.hpp>   // for multiply<>()
-#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK(), try_error_handler
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK(), SLOWMATH_DETAIL_UNLIKELY(), try_error_handler
 #include <slowmath/detail/type_traits.hpp>  // for max_v<>, common_integral_value_type<>, integral_value_type<>, result_t<>, has_wider_type<>
 
 
@@ -89,7 +89,7 @@ factorize_ceili(X x, B b)
 
     auto xFloor = x - floorFac.remainder; // = bᵉ
     auto prodResult = detail::multiply<EH>(xFloor, b - 1);
-    if (EH::is_error(prodResult)) return EH::passthrough_error(prodResult);
+    if (SLOWMATH_DETAIL_UNLIKELY(EH::is_error(prodResult))) return EH::passthrough_error(prodResult);
     auto prod = EH::get_value(prodResult);
 
     auto rCeil = prod - floorFac.remainder; // x = bᵉ + r =: bᵉ⁺¹ - r' ⇒ r' = bᵉ(b - 1) - r
@@ -156,7 +156,7 @@ factorize_ceili(X x, A a, B b)
         // algorithm discussed in http://stackoverflow.com/a/39050139 and slightly altered to avoid unnecessary overflows
 
     auto facAResult = detail::factorize_ceili<EH, E>(x, a);
-    if (EH::is_error(facAResult)) return EH::passthrough_error(facAResult);
+    if (SLOWMATH_DETAIL_UNLIKELY(EH::is_error(facAResult))) return EH::passthrough_error(facAResult);
     auto facA = EH::get_value(facAResult);
 
     SLOWMATH_DETAIL_OVERFLOW_CHECK(x <= max_v<V> - facA.remainder);
@@ -184,7 +184,7 @@ factorize_ceili(X x, A a, B b)
         while (y < x)
         {
             auto yResult = detail::multiply<EH>(y, b);
-            if (EH::is_error(yResult)) return EH::passthrough_error(yResult);
+            if (SLOWMATH_DETAIL_UNLIKELY(EH::is_error(yResult))) return EH::passthrough_error(yResult);
             y = EH::get_value(yResult);
             ++j;
         }
@@ -4,12 +4,13 @@
 
 
 #include <numeric>      // for gcd(), lcm()
-#include <type_traits>  // for is_signed<>
+#include <cstdint>      // for uint64_t
 
 #include <gsl-lite/gsl-lite.hpp>  // for gsl_CPP17_OR_GREATER
 
-#include <slowmath/detail/type_traits.hpp>  // for min_v<>, common_integral_value_type<>, integral_value_type<>, result_t<>
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, is_signed_v<>, make_unsigned_t<>, uint128, common_integral_value_type<>, integral_value_type<>, result_t<>
 #include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK()
+#include <slowmath/detail/intrinsics.hpp>   // for countr_zero()
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -26,6 +27,64 @@ namespace detail
 
 
 #if gsl_CPP17_OR_GREATER
+# if defined(SLOWMATH_DETAIL_HAVE_INT128)
+    // Computes the greatest common divisor of a and b for the native 128-bit integer types, which `std::gcd()` does not support
+    // in strict ISO mode. A single Euclidean step balances the operands, which are then reduced with Stein's algorithm
+    // until they fit in 64 bits; this avoids the expensive multi-word divisions of Euclid's algorithm.
+constexpr uint128
+gcd_uint128(uint128 a, uint128 b)
+{
+    if (a < b)
+    {
+        uint128 t = a;
+        a = b;
+        b = t;
+    }
+    if (b == 0) return a;
+    a %= b;
+    if (a == 0) return b;
+
+    int shift = detail::countr_zero(a | b);
+    a >>= detail::countr_zero(a);
+    b >>= detail::countr_zero(b);
+    while (((a | b) >> 64) != 0)
+    {
+        if (a > b)
+        {
+            uint128 t = a;
+            a = b;
+            b = t;
+        }
+        b -= a;
+        if (b == 0) return a << shift;
+        b >>= detail::countr_zero(b);
+    }
+    return uint128(std::gcd(std::uint64_t(a), std::uint64_t(b))) << shift;
+}
+# endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+
+template <typename V, typename A, typename B>
+constexpr V
+gcd_0(A a, B b)
+{
+    if constexpr (sizeof(V) <= sizeof(std::uint64_t))
+    {
+        return V(std::gcd(integral_value_type<A>(a), integral_value_type<B>(b)));
+    }
+# if defined(SLOWMATH_DETAIL_HAVE_INT128)
+    else
+    {
+        using U = make_unsigned_t<V>;
+
+            // This assumes a two's complement representation.
+        U ua = is_signed_v<V> && V(a) < 0 ? U(-U(V(a))) : U(V(a));
+        U ub = is_signed_v<V> && V(b) < 0 ? U(-U(V(b))) : U(V(b));
+        return V(detail::gcd_uint128(ua, ub));
+    }
+# endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+}
+
+
     // Computes the greatest common divisor of a and b.
 template <typename EH, typename A, typename B>
 constexpr result_t<EH, common_integral_value_type<A, B>>
@@ -33,12 +92,12 @@ gcd(A a, B b)
 {
     using V = common_integral_value_type<A, B>;
 
-    if constexpr (std::is_signed_v<V>)
+    if constexpr (is_signed_v<V>)
     {
             // This assumes a two's complement representation.
         SLOWMATH_DETAIL_OVERFLOW_CHECK(a != min_v<V> && b != min_v<V>);
     }
-    return EH::make_result(V(std::gcd(integral_value_type<A>(a), integral_value_type<B>(b))));
+    return EH::make_result(detail::gcd_0<V>(a, b));
 }
 
 
@@ -51,20 +110,20 @@ lcm(A a, B b)
 
     if (a == 0 || b == 0) return EH::make_result(V(0));
 
-    if constexpr (std::is_signed_v<V>)
+    if constexpr (is_signed_v<V>)
     {
             // This assumes a two's complement representation.
         SLOWMATH_DETAIL_OVERFLOW_CHECK(a != min_v<V> && b != min_v<V>);
 
         V av = a < 0 ? -a : a;
         V bv = b < 0 ? -b : b;
-        V lgcd = std::gcd(av, bv);
+        V lgcd = detail::gcd_0<V>(av, bv);
 
         return detail::multiply<EH>(a / lgcd, b);
     }
     else
     {
-        V lgcd = std::gcd(integral_value_type<A>(a), integral_value_type<B>(b));
+        V lgcd = detail::gcd_0<V>(a, b);
 
         return detail::multiply<EH>(a / lgcd, b);
     }
@@ -0,0 +1,364 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_INTRINSICS_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_INTRINSICS_HPP_
+
+
+#include <climits>      // for CHAR_BIT
+#include <cstdint>      // for uint64_t
+#include <type_traits>  // for integral_constant<>, make_unsigned<>, is_signed<>
+
+#include <slowmath/detail/type_traits.hpp>  // for wider_type<>, uint128
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_FORCEINLINE
+
+
+    // `__builtin_is_constant_evaluated()` is available in all language modes, which allows us to use compiler intrinsics at
+    // runtime and fall back to the portable ISO C++ implementation in constant expressions, even in C++14 and C++17.
+#if !defined(__CUDA_ARCH__)
+# if defined(__clang__)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#   define SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED 1
+#  endif
+#  if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) && __has_builtin(__builtin_mul_overflow)
+#   define SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS 1
+#  endif
+# elif defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#  if __GNUC__ >= 9
+#   define SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED 1
+#  endif
+#  if __GNUC__ >= 5
+#   define SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS 1
+#  endif
+# elif defined(_MSC_VER)
+#  if _MSC_VER >= 1925 // VS 2019 16.5
+#   define SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED 1
+#  endif
+#  if defined(_M_X64)
+#   define SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS 1
+#  endif
+# endif
+#endif // !defined(__CUDA_ARCH__)
+
+#if defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && (defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS) || defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS))
+# define SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS 1
+#endif
+#if defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS)
+# define SLOWMATH_DETAIL_HAVE_MIXED_OVERFLOW_INTRINSICS 1  // overflow intrinsics for operands and results of different types
+#endif
+
+#if defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && !defined(__CUDA_ARCH__)
+# if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS) && defined(__x86_64__) && defined(SLOWMATH_DETAIL_HAVE_INT128)
+#  define SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS 1
+# elif defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS) && _MSC_VER >= 1920 // VS 2019
+#  define SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS 1
+# endif
+#endif
+
+#if defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && !defined(__CUDA_ARCH__)
+# if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#  define SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS 1
+# elif defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+#  define SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS 1
+#  define SLOWMATH_DETAIL_HAVE_MULTIPLY_EXTENDED_INTRINSICS 1  // without a native 128-bit type, the portable implementation needs four multiplications
+# endif
+#endif
+
+#if defined(SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS) && !defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+# include <immintrin.h>  // for _addcarry_u64(), _subborrow_u64()
+#endif
+#if defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+# include <intrin.h>  // for _addcarry_u64(), _subborrow_u64(), _umul128(), _mul128(), _udiv128()
+#endif // defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+#if defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED)
+constexpr SLOWMATH_DETAIL_FORCEINLINE bool
+is_constant_evaluated(void) noexcept
+{
+    return __builtin_is_constant_evaluated();
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED)
+
+
+    // Count the trailing and the leading zero bits of a 64-bit integer u ≠ 0. `__builtin_ctzll()` and `__builtin_clzll()` are not
+    // constant expressions on all compilers, so we use them only at runtime and otherwise fall back to a binary search.
+constexpr int
+countr_zero_u64(std::uint64_t u)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS)
+    if (!detail::is_constant_evaluated()) return __builtin_ctzll(u);
+#endif // defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS)
+    int result = 0;
+    for (int width = 32; width > 0; width /= 2)
+    {
+        if ((u & ((std::uint64_t(1) << width) - 1)) == 0)
+        {
+            result += width;
+            u >>= width;
+        }
+    }
+    return result;
+}
+constexpr int
+countl_zero_u64(std::uint64_t u)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS)
+    if (!detail::is_constant_evaluated()) return __builtin_clzll(u);
+#endif // defined(SLOWMATH_DETAIL_HAVE_IS_CONSTANT_EVALUATED) && defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS)
+    int result = 0;
+    for (int width = 32; width > 0; width /= 2)
+    {
+        if ((u >> (64 - width)) == 0)
+        {
+            result += width;
+            u <<= width;
+        }
+    }
+    return result;
+}
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+constexpr int
+countr_zero(uint128 u) // u ≠ 0
+{
+    auto lo = std::uint64_t(u);
+    return lo != 0
+        ? detail::countr_zero_u64(lo)
+        : 64 + detail::countr_zero_u64(std::uint64_t(u >> 64));
+}
+constexpr int
+bit_width(uint128 u) // u ≠ 0
+{
+    auto hi = std::uint64_t(u >> 64);
+    return hi != 0
+        ? 128 - detail::countl_zero_u64(hi)
+        : 64 - detail::countl_zero_u64(std::uint64_t(u));
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+
+
+#if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+    // The following functions compute the wrapped result of the given operation and return `true` if the operation overflowed.
+    // They can not be used in constant expressions and must be guarded with `is_constant_evaluated()`.
+
+# if defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS)
+    // The overflow builtins also accept operands and results of different types; they then check whether the infinitely precise
+    // result is representable by the result type.
+template <typename A, typename B, typename R>
+SLOWMATH_DETAIL_FORCEINLINE bool
+add_overflow(A a, B b, R& result) noexcept
+{
+    return __builtin_add_overflow(a, b, &result);
+}
+template <typename A, typename B, typename R>
+SLOWMATH_DETAIL_FORCEINLINE bool
+subtract_overflow(A a, B b, R& result) noexcept
+{
+    return __builtin_sub_overflow(a, b, &result);
+}
+template <typename A, typename B, typename R>
+SLOWMATH_DETAIL_FORCEINLINE bool
+multiply_overflow(A a, B b, R& result) noexcept
+{
+    return __builtin_mul_overflow(a, b, &result);
+}
+#  if defined(__clang__)
+    // Clang lowers `__builtin_mul_overflow()` for 128-bit operands to a call to `__muloti4()`, which is provided by compiler-rt
+    // but not by libgcc. Operands of different signedness or size may require a 128-bit intermediate already for 64-bit types.
+template <typename V> constexpr bool have_multiply_overflow_v = sizeof(V) <= sizeof(std::uint64_t);
+template <typename V> constexpr bool have_mixed_multiply_overflow_v = sizeof(V) < sizeof(std::uint64_t);
+#  else // !defined(__clang__)
+template <typename V> constexpr bool have_multiply_overflow_v = true;
+template <typename V> constexpr bool have_mixed_multiply_overflow_v = true;
+#  endif // defined(__clang__)
+# else // defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+template <typename V>
+SLOWMATH_DETAIL_FORCEINLINE bool
+add_overflow(V a, V b, V& result) noexcept
+{
+    using U = std::make_unsigned_t<V>;
+
+    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    {
+            // Signed overflow occurred iff both operands have the same sign and the sign of the result differs.
+            // This assumes a two's complement representation.
+        result = V(U(a) + U(b));
+        return ((a ^ result) & (b ^ result)) < 0;
+    }
+    else if (sizeof(V) == sizeof(unsigned __int64))
+    {
+        unsigned __int64 r;
+        bool carry = _addcarry_u64(0, static_cast<unsigned __int64>(a), static_cast<unsigned __int64>(b), &r) != 0;
+        result = V(r);
+        return carry;
+    }
+    else
+    {
+        result = V(a + b);
+        return result < a;
+    }
+}
+template <typename V>
+SLOWMATH_DETAIL_FORCEINLINE bool
+subtract_overflow(V a, V b, V& result) noexcept
+{
+    using U = std::make_unsigned_t<V>;
+
+    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    {
+            // Signed overflow occurred iff the operands have different signs and the sign of the result differs from the sign of a.
+            // This assumes a two's complement representation.
+        result = V(U(a) - U(b));
+        return ((a ^ b) & (a ^ result)) < 0;
+    }
+    else if (sizeof(V) == sizeof(unsigned __int64))
+    {
+        unsigned __int64 r;
+        bool borrow = _subborrow_u64(0, static_cast<unsigned __int64>(a), static_cast<unsigned __int64>(b), &r) != 0;
+        result = V(r);
+        return borrow;
+    }
+    else
+    {
+        result = V(a - b);
+        return a < b;
+    }
+}
+template <typename V>
+SLOWMATH_DETAIL_FORCEINLINE bool
+multiply_overflow_0(std::true_type /*isNarrow*/, V a, V b, V& result) noexcept
+{
+    using W = wider_type<V>;
+
+    W wresult = W(a) * W(b);
+    result = V(wresult);
+    return wresult != W(result);
+}
+template <typename V>
+SLOWMATH_DETAIL_FORCEINLINE bool
+multiply_overflow_0(std::false_type /*isNarrow*/, V a, V b, V& result) noexcept
+{
+    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    {
+        __int64 hi;
+        __int64 lo = _mul128(static_cast<__int64>(a), static_cast<__int64>(b), &hi);
+        result = V(lo);
+        return hi != (lo >> 63);
+    }
+    else
+    {
+        unsigned __int64 hi;
+        unsigned __int64 lo = _umul128(static_cast<unsigned __int64>(a), static_cast<unsigned __int64>(b), &hi);
+        result = V(lo);
+        return hi != 0;
+    }
+}
+template <typename V>
+SLOWMATH_DETAIL_FORCEINLINE bool
+multiply_overflow(V a, V b, V& result) noexcept
+{
+    return detail::multiply_overflow_0(std::integral_constant<bool, sizeof(V) < sizeof(__int64)>{ }, a, b, result);
+}
+template <typename V> constexpr bool have_multiply_overflow_v = true;
+# endif // defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_BUILTINS)
+#endif // defined(SLOWMATH_DETAIL_HAVE_OVERFLOW_INTRINSICS)
+
+
+#if defined(SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS)
+    // Computes the full-width product hi ∙ 2⁶⁴ + lo of a and b.
+SLOWMATH_DETAIL_FORCEINLINE std::uint64_t
+multiply_double_word_u64(std::uint64_t a, std::uint64_t b, std::uint64_t& hi) noexcept
+{
+# if defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+    return _umul128(a, b, &hi);
+# else // !defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+    uint128 product = uint128(a) * b;
+    hi = std::uint64_t(product >> 64);
+    return std::uint64_t(product);
+# endif // defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+}
+
+    // Computes the quotient and the remainder of hi ∙ 2⁶⁴ + lo divided by d with a single `div` instruction. The quotient must be
+    // representable, i.e. hi < d; otherwise the instruction raises a divide error.
+SLOWMATH_DETAIL_FORCEINLINE std::uint64_t
+divide_double_word_u64(std::uint64_t hi, std::uint64_t lo, std::uint64_t d, std::uint64_t& remainder) noexcept
+{
+# if defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+    return _udiv128(hi, lo, d, &remainder);
+# else // !defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+    std::uint64_t quotient;
+    __asm__("divq %4" : "=a"(quotient), "=d"(remainder) : "a"(lo), "d"(hi), "rm"(d));
+    return quotient;
+# endif // defined(SLOWMATH_DETAIL_HAVE_MSVC_X64_INTRINSICS)
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS)
+
+
+#if defined(SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS)
+    // Computes a + b + carryIn and returns the carry. The compiler can chain successive calls into a sequence of `adc` instructions,
+    // which it does not reliably do for the portable implementation. U must be a 64-bit type; the template merely allows the call
+    // to be compiled for other types in a branch which is never taken.
+template <typename U>
+SLOWMATH_DETAIL_FORCEINLINE bool
+add_with_carry_u64(U a, U b, bool carryIn, U& sum) noexcept
+{
+    unsigned long long result;
+    bool carryOut = _addcarry_u64(static_cast<unsigned char>(carryIn), static_cast<unsigned long long>(a), static_cast<unsigned long long>(b), &result) != 0;
+    sum = U(result);
+    return carryOut;
+}
+template <typename U>
+SLOWMATH_DETAIL_FORCEINLINE bool
+subtract_with_borrow_u64(U a, U b, bool borrowIn, U& difference) noexcept
+{
+    unsigned long long result;
+    bool borrowOut = _subborrow_u64(static_cast<unsigned char>(borrowIn), static_cast<unsigned long long>(a), static_cast<unsigned long long>(b), &result) != 0;
+    difference = U(result);
+    return borrowOut;
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_CARRY_INTRINSICS)
+
+#if defined(SLOWMATH_DETAIL_HAVE_MULTIPLY_EXTENDED_INTRINSICS)
+    // Computes the full-width product hi ∙ 2⁶⁴ + lo of the 64-bit integers a and b and returns hi.
+template <typename V>
+SLOWMATH_DETAIL_FORCEINLINE V
+multiply_extended_64(V a, V b, std::make_unsigned_t<V>& lo) noexcept
+{
+    if (std::is_signed<V>::value) // should be `if constexpr` in C++17
+    {
+        __int64 hi;
+        lo = std::make_unsigned_t<V>(_mul128(static_cast<__int64>(a), static_cast<__int64>(b), &hi));
+        return V(hi);
+    }
+    else
+    {
+        unsigned __int64 hi;
+        lo = std::make_unsigned_t<V>(_umul128(static_cast<unsigned __int64>(a), static_cast<unsigned __int64>(b), &hi));
+        return V(hi);
+    }
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_MULTIPLY_EXTENDED_INTRINSICS)
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_INTRINSICS_HPP_
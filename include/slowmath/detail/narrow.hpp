@@ -0,0 +1,136 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_NARROW_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_NARROW_HPP_
+
+
+#include <cstddef>  // for size_t
+
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, is_signed_v<>, make_signed_t<>, make_unsigned_t<>, integral_value_type<>, result_t<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(), wrapping_result<>
+#include <slowmath/detail/compare.hpp>      // for less()
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // The values of V which are representable by R form the range [lo, hi]. Because the ranges of both types are of the form
+    // [0, 2ᴺ - 1] or [-2ᴺ⁻¹, 2ᴺ⁻¹ - 1], the number of values in this range is a power of two, and v is representable iff the offset
+    // v - lo, computed as an unsigned number, has no bits set outside of hi - lo. This assumes a two's complement representation.
+template <typename R, typename V>
+struct narrow_bounds
+{
+    using U = make_unsigned_t<V>;
+
+    static constexpr V lo = detail::less(min_v<V>, min_v<R>) ? V(min_v<R>) : min_v<V>;
+    static constexpr V hi = detail::less(max_v<R>, max_v<V>) ? V(max_v<R>) : max_v<V>;
+    static constexpr U mask = U(U(hi) - U(lo));
+    static constexpr bool isNarrowing = lo != min_v<V> || hi != max_v<V>;
+
+    static_assert((mask & U(mask + 1)) == 0, "range of representable values must be a power of two");
+};
+
+template <typename R, typename V>
+constexpr make_unsigned_t<V>
+narrow_offset(V v)
+{
+    using U = make_unsigned_t<V>;
+
+    return U(U(v) - U(narrow_bounds<R, V>::lo));
+}
+
+
+    // Converts v to R for arguments of arbitrary signedness and checks that the value is representable by R.
+template <typename EH, typename R, typename V>
+constexpr result_t<EH, R>
+narrow(V v)
+{
+    using V0 = integral_value_type<V>;
+    using S = make_signed_t<V0>;
+
+    constexpr make_unsigned_t<V0> mask = narrow_bounds<R, V0>::mask;
+
+    V0 v0 = V0(v);
+    bool negative = is_signed_v<V0> && S(v0) < 0; // cast to signed to avoid warning about pointless unsigned comparison
+    SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(detail::narrow_offset<R>(v0) <= mask, negative);
+    return EH::make_result(R(v0));
+}
+
+    // Converts v to R, discarding high bits, and determines whether the value is not representable by R.
+template <typename R, typename V>
+constexpr wrapping_result<R>
+narrow_wrapping(V v)
+{
+    using V0 = integral_value_type<V>;
+
+    V0 v0 = V0(v);
+    return { R(v0), detail::narrow_offset<R>(v0) > narrow_bounds<R, V0>::mask };
+}
+
+
+    // Converts the n elements of src to R and stores them in dst. Returns the number of elements converted, which is less than n
+    // iff the element at that index is not representable by R; the elements of dst from that index on have unspecified values.
+    //
+    // The elements are converted in blocks. For every block, the range check is done with an OR reduction of the offsets of the
+    // elements, which the compiler can vectorize along with the conversion. Only for a block which fails the check, the elements
+    // are checked individually to find the first offending index.
+template <typename R, typename V>
+std::size_t
+narrow_batch(V const* src, R* dst, std::size_t n)
+{
+    using U = make_unsigned_t<V>;
+
+    constexpr std::size_t blockSize = 256;
+    constexpr U mask = narrow_bounds<R, V>::mask;
+
+    if (!narrow_bounds<R, V>::isNarrowing) // should be `if constexpr` in C++17
+    {
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            dst[i] = R(src[i]);
+        }
+        return n;
+    }
+
+    for (std::size_t i0 = 0; i0 != n; )
+    {
+        std::size_t i1 = n - i0 > blockSize ? i0 + blockSize : n;
+        U offsets = 0;
+        for (std::size_t i = i0; i != i1; ++i)
+        {
+            offsets |= detail::narrow_offset<R>(src[i]);
+            dst[i] = R(src[i]);
+        }
+        if ((offsets & U(~mask)) != 0)
+        {
+            for (std::size_t i = i0; ; ++i)
+            {
+                if (detail::narrow_offset<R>(src[i]) > mask) return i;
+            }
+        }
+        i0 = i1;
+    }
+    return n;
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_NARROW_HPP_
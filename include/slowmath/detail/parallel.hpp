@@ -0,0 +1,221 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_PARALLEL_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_PARALLEL_HPP_
+
+
+#include <thread>
+#include <vector>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+
+#include <slowmath/detail/type_traits.hpp>  // for make_unsigned_t<>, result_t<>
+#include <slowmath/detail/batch.hpp>        // for invoke_kernel(), scan_batch()
+#include <slowmath/detail/reduce.hpp>       // for wide_lane_t<>, triple_word<>, product_state<>, accumulate(), widen_lane(), triple_word_fits(), sum_result(), product_result(), *_kernel
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // The parallel operations split the elements into contiguous chunks of nearly equal size, one per thread, and process each
+    // chunk with the sequential kernel. The results of the chunks are then combined in the order of the chunks, so the result
+    // does not depend on the number of threads. Threads are started for every operation, so the chunks should be large enough
+    // to amortize the cost of starting a thread.
+
+struct chunk_range
+{
+    std::size_t begin;
+    std::size_t end;
+};
+
+inline chunk_range
+get_chunk_range(std::size_t n, std::size_t numChunks, std::size_t i) noexcept
+{
+    std::size_t size = n / numChunks;
+    std::size_t remainder = n % numChunks;
+    std::size_t begin = size * i + (i < remainder ? i : remainder);
+    return { begin, begin + size + (i < remainder ? 1 : 0) };
+}
+
+inline std::size_t
+get_num_chunks(unsigned numThreads, std::size_t minChunkSize, std::size_t n) noexcept
+{
+    std::size_t maxChunks = numThreads != 0 ? numThreads : std::thread::hardware_concurrency();
+    if (minChunkSize != 0 && n / minChunkSize < maxChunks) maxChunks = n / minChunkSize;
+    return maxChunks != 0 ? maxChunks : 1;
+}
+
+template <typename PolicyT>
+std::size_t
+get_num_chunks(PolicyT const& policy, std::size_t n) noexcept
+{
+    return detail::get_num_chunks(policy.numThreads, policy.minChunkSize, n);
+}
+
+    // Joins the threads when going out of scope, which is necessary if starting a thread fails with an exception.
+struct thread_joiner
+{
+    std::vector<std::thread>& threads;
+
+    ~thread_joiner()
+    {
+        for (auto& thread : threads)
+        {
+            if (thread.joinable()) thread.join();
+        }
+    }
+};
+
+    // Calls f(i, range) for the chunks i = 0, …, numChunks - 1 concurrently; the first chunk is processed by the calling thread.
+    // f must not throw exceptions.
+template <typename F>
+void
+for_each_chunk(std::size_t numChunks, std::size_t n, F const& f)
+{
+    auto threads = std::vector<std::thread>{ };
+    auto joiner = thread_joiner{ threads };
+    threads.reserve(numChunks - 1);
+    for (std::size_t i = 1; i < numChunks; ++i)
+    {
+        threads.emplace_back([&f, n, numChunks, i]
+        {
+            f(i, detail::get_chunk_range(n, numChunks, i));
+        });
+    }
+    f(0, detail::get_chunk_range(n, numChunks, 0));
+}
+
+    // Applies the batch operation `batch(i, range)`, which returns the number of elements of the i-th chunk computed before the
+    // first offending element, to the chunks concurrently. Returns the index of the first offending element, or n if there is
+    // none.
+template <typename F>
+std::size_t
+parallel_batch(std::size_t numChunks, std::size_t n, F const& batch)
+{
+    if (numChunks == 1) return batch(std::size_t(0), chunk_range{ 0, n });
+
+    auto counts = std::vector<std::size_t>(numChunks);
+    detail::for_each_chunk(numChunks, n,
+        [&counts, &batch](std::size_t i, chunk_range range)
+        {
+            counts[i] = batch(i, range);
+        });
+    for (std::size_t i = 0; i != numChunks; ++i)
+    {
+        auto range = detail::get_chunk_range(n, numChunks, i);
+        if (counts[i] != range.end - range.begin) return range.begin + counts[i];
+    }
+    return n;
+}
+
+    // Computes `reduce(begin, end)` for the chunks concurrently and accumulates the partial results in the order of the chunks.
+template <typename T, typename F>
+T
+parallel_reduce(std::size_t numChunks, std::size_t n, F const& reduce)
+{
+    if (numChunks == 1) return reduce(std::size_t(0), n);
+
+    auto partials = std::vector<T>(numChunks);
+    detail::for_each_chunk(numChunks, n,
+        [&partials, &reduce](std::size_t i, chunk_range range)
+        {
+            partials[i] = reduce(range.begin, range.end);
+        });
+    T result = partials[0];
+    for (std::size_t i = 1; i != numChunks; ++i)
+    {
+        detail::accumulate(result, partials[i]);
+    }
+    return result;
+}
+
+
+template <typename EH, typename V>
+result_t<EH, V>
+parallel_sum(std::size_t numChunks, V const* v, std::size_t n)
+{
+    static_assert(sizeof(V) <= sizeof(std::uint64_t), "reductions support integral types of up to 64 bits");
+
+    auto acc = detail::parallel_reduce<triple_word<wide_lane_t<V>>>(numChunks, n,
+        [v](std::size_t begin, std::size_t end)
+        {
+            return detail::invoke_kernel<sum_kernel>(v + begin, end - begin);
+        });
+    return detail::sum_result<EH, V>(acc);
+}
+
+template <typename EH, typename V, typename A, typename B>
+result_t<EH, V>
+parallel_dot(std::size_t numChunks, A const* a, B const* b, std::size_t n)
+{
+    static_assert(sizeof(V) <= sizeof(std::uint64_t), "reductions support integral types of up to 64 bits");
+
+    auto acc = detail::parallel_reduce<triple_word<wide_lane_t<V>>>(numChunks, n,
+        [a, b](std::size_t begin, std::size_t end)
+        {
+            return detail::invoke_kernel<dot_kernel>(a + begin, b + begin, end - begin);
+        });
+    return detail::sum_result<EH, V>(acc);
+}
+
+template <typename EH, typename V>
+result_t<EH, V>
+parallel_product(std::size_t numChunks, V const* v, std::size_t n)
+{
+    static_assert(sizeof(V) <= sizeof(std::uint64_t), "reductions support integral types of up to 64 bits");
+
+    auto state = detail::parallel_reduce<product_state<V>>(numChunks, n,
+        [v](std::size_t begin, std::size_t end)
+        {
+            return detail::invoke_kernel<product_kernel>(v + begin, end - begin);
+        });
+    return detail::product_result<EH>(state);
+}
+
+    // The parallel scan makes two passes over the elements. The first pass computes the exact sum of every chunk, from which the
+    // exact running sum at the beginning of each chunk is computed. The second pass then scans the chunks concurrently, starting
+    // with these running sums. If the running sum at the beginning of a chunk is not representable, the chunk is not scanned,
+    // and its first element is reported as offending. For an exclusive scan, this is the running sum stored for that element;
+    // for an inclusive scan, it is the running sum stored for the last element of the preceding chunk, so the scan of an earlier
+    // chunk reports an offending element with a smaller index.
+template <bool Inclusive, typename R, typename V>
+std::size_t
+parallel_scan(std::size_t numChunks, V const* src, R* dst, std::size_t n, R init)
+{
+    using W = wide_lane_t<R>;
+
+    if (numChunks == 1) return detail::scan_batch<Inclusive>(src, dst, n, init);
+
+    auto offsets = std::vector<triple_word<W>>(numChunks);
+    detail::for_each_chunk(numChunks, n,
+        [&offsets, src](std::size_t i, chunk_range range)
+        {
+            offsets[i] = detail::invoke_kernel<sum_kernel>(src + range.begin, range.end - range.begin);
+        });
+    auto acc = triple_word<W>{ };
+    detail::accumulate(acc, detail::widen_lane(W(init)));
+    for (auto& offset : offsets)
+    {
+        auto chunkSum = offset;
+        offset = acc;
+        detail::accumulate(acc, chunkSum);
+    }
+
+    return detail::parallel_batch(numChunks, n,
+        [&offsets, src, dst](std::size_t i, chunk_range range)
+        {
+            if (!detail::triple_word_fits<R>(offsets[i])) return std::size_t(0);
+            return detail::scan_batch<Inclusive>(src + range.begin, dst + range.begin, range.end - range.begin, R(offsets[i].lo));
+        });
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_PARALLEL_HPP_
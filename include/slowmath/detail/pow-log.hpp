@@ -3,12 +3,16 @@
 #define INCLUDED_SLOWMATH_DETAIL_POW_LOG_HPP_
 
 
-#include <type_traits>  // for integral_constant<>, make_unsigned<>, is_signed<>
+#include <cstdint>      // for uint64_t
+#include <type_traits>  // for integral_constant<>
 
 #include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_CPP17_OR_GREATER
 
-#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, common_integral_value_type<>, integral_value_type<>, result_t<>
-#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK()
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, is_signed_v<>, make_unsigned_t<>, common_integral_value_type<>, integral_value_type<>, result_t<>, has_wider_type<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK(), SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(), SLOWMATH_DETAIL_UNLIKELY()
+#include <slowmath/detail/arithmetic.hpp>   // for multiply(), multiply_wrapping()
+#include <slowmath/detail/double-word.hpp>  // for widening_multiply(), fits(), truncate()
+#include <slowmath/detail/intrinsics.hpp>   // for countr_zero(), bit_width()
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -44,13 +48,13 @@ sqrti(V v)
 
     // Computes v².
 template <typename EH, typename V>
-constexpr integral_value_type<V>
+constexpr result_t<EH, integral_value_type<V>>
 square(V v)
 {
     using V0 = integral_value_type<V>;
 
     constexpr V0 m = detail::sqrti(max_v<V0>);
-    SLOWMATH_DETAIL_OVERFLOW_CHECK(v <= m && (!std::is_signed<V0>::value || v >= -m));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(v <= m && (!is_signed_v<V0> || v >= -m));
     return EH::make_result(V0(v*v));
 }
 
@@ -71,11 +75,34 @@ bit_scan_reverse(U mask)
     // Computes bᵉ for b, e ∊ ℕ₀.
 template <typename EH, typename B, typename E>
 constexpr result_t<EH, integral_value_type<B>>
-powi_0(B b, E e)
+powi_narrow(B b, E e)
 {
     using V = integral_value_type<B>;
     using E0 = integral_value_type<E>;
 
+    V cb = 1;
+    for (E0 bit = E0(1) << E0(detail::bit_scan_reverse(e)); bit > 0; bit >>= 1)
+    {
+        auto cbSq = detail::widening_multiply<V>(cb, cb);
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<V>(cbSq));
+        cb = detail::truncate<V>(cbSq);
+        if ((e & bit) != 0)
+        {
+            auto cbb = detail::widening_multiply<V>(cb, b);
+            SLOWMATH_DETAIL_OVERFLOW_CHECK(detail::fits<V>(cbb));
+            cb = detail::truncate<V>(cbb);
+        }
+    }
+    return EH::make_result(V(cb));
+}
+template <typename EH, typename B, typename E>
+constexpr result_t<EH, integral_value_type<B>>
+powi_bounded(B b, E e)
+{
+    using V = integral_value_type<B>;
+    using E0 = integral_value_type<E>;
+
+        // A widening multiplication is no faster than a comparison with a precomputed bound if the wider type is a double word.
     constexpr V mSq = detail::sqrti(max_v<V>);
     V mb = max_v<V> / b;
 
@@ -94,33 +121,85 @@ powi_0(B b, E e)
 }
 template <typename EH, typename B, typename E>
 constexpr result_t<EH, integral_value_type<B>>
+powi_wide(B b, E e)
+{
+    using V = integral_value_type<B>;
+    using E0 = integral_value_type<E>;
+
+        // There is no wider type, so we check every multiplication with `multiply()`, which is cheaper than precomputing the
+        // bound `max_v<V> / b` with a multi-word division.
+    V cb = 1;
+    for (E0 bit = E0(1) << E0(detail::bit_scan_reverse(e)); bit > 0; bit >>= 1)
+    {
+        auto cbSqR = detail::multiply<EH>(cb, cb);
+        if (SLOWMATH_DETAIL_UNLIKELY(EH::is_error(cbSqR))) return EH::passthrough_error(cbSqR);
+        cb = EH::get_value(cbSqR);
+        if ((e & bit) != 0)
+        {
+            auto cbbR = detail::multiply<EH>(cb, b);
+            if (SLOWMATH_DETAIL_UNLIKELY(EH::is_error(cbbR))) return EH::passthrough_error(cbbR);
+            cb = EH::get_value(cbbR);
+        }
+    }
+    return EH::make_result(V(cb));
+}
+template <typename EH, typename B, typename E>
+constexpr result_t<EH, integral_value_type<B>>
+powi_1(std::true_type /*hasWiderType*/, B b, E e)
+{
+    return detail::powi_bounded<EH>(b, e);
+}
+template <typename EH, typename B, typename E>
+constexpr result_t<EH, integral_value_type<B>>
+powi_1(std::false_type /*hasWiderType*/, B b, E e)
+{
+    return detail::powi_wide<EH>(b, e);
+}
+    // The widening multiplication in `powi_narrow()` pays off only if the wider type fits into a machine word.
+template <typename V> struct powi_is_narrow : std::integral_constant<bool, (sizeof(V) < sizeof(std::uint64_t))> { };
+template <typename EH, typename B, typename E>
+constexpr result_t<EH, integral_value_type<B>>
+powi_0(std::true_type /*isNarrow*/, B b, E e)
+{
+    return detail::powi_narrow<EH>(b, e);
+}
+template <typename EH, typename B, typename E>
+constexpr result_t<EH, integral_value_type<B>>
+powi_0(std::false_type /*isNarrow*/, B b, E e)
+{
+    return detail::powi_1<EH>(has_wider_type<integral_value_type<B>>{ }, b, e);
+}
+template <typename EH, typename B, typename E>
+constexpr result_t<EH, integral_value_type<B>>
 powi(B b, E e)
 {
     using V = integral_value_type<B>;
-    using U = std::make_unsigned_t<V>;
+    using U = make_unsigned_t<V>;
 
-        // Case needs to be handled separately to avoid division by zero in `powi_0()`.
+        // Case needs to be handled separately to avoid division by zero in `powi_bounded()`.
     if (b == 0) return EH::make_result(V(e == 0 ? 1 : 0));
 
     if (b < 0)
     {
             // Compute `powi()` for unsigned positive number. Here we exploit that `-U(min_v<V>) == U(min_v<V>)`.
-        U uresult = powi_0<EH>(U(-U(b)), e);
+        auto uresultR = detail::powi_0<EH>(powi_is_narrow<U>{ }, U(-U(b)), e);
+        if (SLOWMATH_DETAIL_UNLIKELY(EH::is_error(uresultR))) return EH::passthrough_error(uresultR);
+        U uresult = EH::get_value(uresultR);
         bool negate = e % 2 != 0;
 
             // Check for overflow (note the slightly different treatment of positive vs. negative results).
-        SLOWMATH_DETAIL_OVERFLOW_CHECK(uresult <= U(min_v<V>) && (uresult != U(min_v<V>) || negate));
+        SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(uresult <= U(min_v<V>) && (uresult != U(min_v<V>) || negate), negate);
 
         return EH::make_result(negate ? V(-uresult) : V(uresult));
     }
-    return detail::powi_0<EH>(b, e);
+    return detail::powi_0<EH>(powi_is_narrow<V>{ }, b, e);
 }
 
 
     // Computes ⌊log x ÷ log b⌋ for x,b ∊ ℕ, x > 0, b > 1.
 template <typename E, typename X, typename B>
 constexpr E
-log_floori(X x, B b)
+log_floori_0(std::true_type /*hasWiderType*/, X x, B b)
 {
     using V = common_integral_value_type<X, B>;
 
@@ -147,12 +226,75 @@ log_floori(X x, B b)
         ++e;
     }
 }
+    // Computes e = ⌊log x ÷ log b⌋ and bᵉ for x,b ∊ ℕ, x > 0, b > 1. There is no wider type, so instead of precomputing the bound
+    // `max_v<V> / b` with a multi-word division and then multiplying by b up to e times, we compute b, b², b⁴, ... by repeated
+    // squaring and determine the bits of e with a binary search. Every multiplication is checked for overflow. For a power of
+    // two b = 2ᵏ, e is obtained from the bit width of x.
+template <typename E, typename V>
+constexpr E
+log_floori_wide(V x, V b, V& power)
+{
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+    if ((b & (b - 1)) == 0)
+    {
+        using U = make_unsigned_t<V>;
+
+        int k = detail::countr_zero(uint128(U(b)));
+        int ek = (detail::bit_width(uint128(U(x))) - 1) / k * k;
+        power = V(U(1) << ek);
+        return E(ek / k);
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+
+        // b^(2ᵏ) ≤ x ≤ max_v<V> implies 2ᵏ < N, hence k < log₂ N ≤ 7 for N = 128.
+    V squares[8] = { };
+    int k = -1;
+    for (V sq = b; sq <= x; )
+    {
+        squares[++k] = sq;
+        if (k == 7) break;
+        auto r = detail::multiply_wrapping(sq, sq);
+        if (r.overflow) break;
+        sq = r.value;
+    }
+
+    E e = 0;
+    V x0 = 1;
+    for (; k >= 0; --k)
+    {
+        auto x1 = detail::multiply_wrapping(x0, squares[k]);
+        if (!x1.overflow && x1.value <= x)
+        {
+            x0 = x1.value;
+            e = E(e + (E(1) << k));
+        }
+    }
+    power = x0;
+    return e;
+}
+template <typename E, typename X, typename B>
+constexpr E
+log_floori_0(std::false_type /*hasWiderType*/, X x, B b)
+{
+    using V = common_integral_value_type<X, B>;
+
+    V power = 0;
+    return detail::log_floori_wide<E>(V(x), V(b), power);
+}
+template <typename E, typename X, typename B>
+constexpr E
+log_floori(X x, B b)
+{
+    using V = common_integral_value_type<X, B>;
+
+    return detail::log_floori_0<E>(has_wider_type<V>{ }, x, b);
+}
 
 
     // Computes ⌈log x ÷ log b⌉ for x,b ∊ ℕ, x > 0, b > 1.
 template <typename E, typename X, typename B>
 constexpr E
-log_ceili(X x, B b)
+log_ceili_0(std::true_type /*hasWiderType*/, X x, B b)
 {
     using V = common_integral_value_type<X, B>;
 
@@ -177,6 +319,24 @@ log_ceili(X x, B b)
 
     return e;
 }
+template <typename E, typename X, typename B>
+constexpr E
+log_ceili_0(std::false_type /*hasWiderType*/, X x, B b)
+{
+    using V = common_integral_value_type<X, B>;
+
+    V power = 0;
+    E e = detail::log_floori_wide<E>(V(x), V(b), power);
+    return power < V(x) ? E(e + 1) : e;
+}
+template <typename E, typename X, typename B>
+constexpr E
+log_ceili(X x, B b)
+{
+    using V = common_integral_value_type<X, B>;
+
+    return detail::log_ceili_0<E>(has_wider_type<V>{ }, x, b);
+}
 
 
 } // namespace detail
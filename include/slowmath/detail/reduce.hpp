@@ -0,0 +1,427 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_REDUCE_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_REDUCE_HPP_
+
+
+#include <climits>      // for CHAR_BIT
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t, uint64_t
+#include <type_traits>  // for integral_constant<>, conditional<>
+
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, is_signed_v<>, make_signed_t<>, make_unsigned_t<>, common_integral_value_type<>, result_t<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_FORCEINLINE, SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK()
+#include <slowmath/detail/arithmetic.hpp>   // for magnitude(), is_negative(), multiply_wrapping()
+#include <slowmath/detail/double-word.hpp>  // for double_word<>, widening_multiply(), high_word(), truncate()
+#include <slowmath/detail/narrow.hpp>       // for narrow_bounds<>, narrow_offset()
+#include <slowmath/detail/batch.hpp>        // for invoke_kernel()
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+# pragma warning(disable: 4146) // unary minus operator applied to unsigned type, result still unsigned
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // The reductions compute the exact result and check only once whether it is representable; intermediate results may thus
+    // exceed the range of the result type. This makes the overflow condition independent of the order of evaluation.
+    //
+    // Sums are accumulated in 64-bit lanes which cannot overflow within a block of elements. For 8-, 16- and 32-bit elements,
+    // the elements are added to the lanes directly; 64-bit elements and the products of 32-bit elements are split into their
+    // high and low halves, and the products of 64-bit elements into four 32-bit parts, which are summed separately. The sum of
+    // each block is then added to a 192-bit total. The loops over the blocks have no branches and no loop-carried dependency other than the additions, so the
+    // compiler can vectorize them.
+
+template <typename V> using wide_lane_t = std::conditional_t<is_signed_v<V>, std::int64_t, std::uint64_t>;
+
+constexpr std::size_t reduce_block_size = std::size_t(1) << 16;
+
+    // Represents the value hi ∙ 2²ᴺ + mid ∙ 2ᴺ + lo, where N is the number of bits in V. `hi` is signed iff V is signed.
+template <typename V>
+struct triple_word
+{
+    V hi;
+    make_unsigned_t<V> mid;
+    make_unsigned_t<V> lo;
+};
+
+    // Adds the value w.hi ∙ 2ᴺ + w.lo to the accumulator.
+template <typename V>
+constexpr void
+accumulate(triple_word<V>& acc, double_word<V> w)
+{
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+        // This assumes a two's complement representation.
+    U lo = U(acc.lo + w.lo);
+    U carry0 = lo < w.lo ? 1 : 0;
+    U mid0 = U(acc.mid + U(w.hi));
+    U carry1 = mid0 < acc.mid ? 1 : 0;
+    U mid = U(mid0 + carry0);
+    U carry2 = mid < mid0 ? 1 : 0;
+    U signExtension = is_signed_v<V> && S(w.hi) < 0 ? max_v<U> : U(0);
+    acc = { V(U(U(acc.hi) + signExtension + carry1 + carry2)), mid, lo };
+}
+
+    // Adds the value (w.hi ∙ 2ᴺ + w.lo) ∙ 2ᴺ to the accumulator.
+template <typename V>
+constexpr void
+accumulate_high(triple_word<V>& acc, double_word<V> w)
+{
+    using U = make_unsigned_t<V>;
+
+        // This assumes a two's complement representation.
+    U mid = U(acc.mid + w.lo);
+    U carry = mid < w.lo ? 1 : 0;
+    acc = { V(U(U(acc.hi) + U(w.hi) + carry)), mid, acc.lo };
+}
+
+    // Computes the value hi ∙ 2ᴺᐟ² + lo for the sums of high and low halves of a block as a double word.
+template <typename V>
+constexpr double_word<V>
+combine_halves(V hi, make_unsigned_t<V> lo)
+{
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+    constexpr int halfBits = sizeof(V) * CHAR_BIT / 2;
+
+        // This assumes a two's complement representation.
+    U wlo = U(U(U(hi) << halfBits) + lo);
+    U carry = wlo < lo ? 1 : 0;
+    U whi = is_signed_v<V> ? U(S(hi) >> halfBits) : U(U(hi) >> halfBits);
+    return { V(whi + carry), wlo };
+}
+
+template <typename V>
+constexpr double_word<V>
+widen_lane(V v)
+{
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+    return { V(is_signed_v<V> && S(v) < 0 ? -1 : 0), U(v) };
+}
+
+template <typename R, typename V>
+constexpr bool
+triple_word_fits(triple_word<V> const& acc)
+{
+    using S = make_signed_t<V>;
+    using U = make_unsigned_t<V>;
+
+        // This assumes a two's complement representation.
+    U midExtension = is_signed_v<V> && S(acc.lo) < 0 ? max_v<U> : U(0);
+    U hiExtension = is_signed_v<V> && S(acc.mid) < 0 ? max_v<U> : U(0);
+    return U(acc.hi) == hiExtension && acc.mid == midExtension
+        && detail::narrow_offset<R>(V(acc.lo)) <= narrow_bounds<R, V>::mask;
+}
+
+template <typename V>
+constexpr bool
+triple_word_is_negative(triple_word<V> const& acc)
+{
+    using S = make_signed_t<V>;
+
+    return is_signed_v<V> && S(acc.hi) < 0;
+}
+
+    // Splits the 64-bit value v into its high and low halves and adds them to the respective lanes.
+template <typename W>
+SLOWMATH_DETAIL_FORCEINLINE void
+accumulate_halves(W& hi, make_unsigned_t<W>& lo, W v)
+{
+    using U = make_unsigned_t<W>;
+    constexpr int halfBits = sizeof(W) * CHAR_BIT / 2;
+    constexpr U halfMask = U(U(1) << halfBits) - 1;
+
+        // This assumes a two's complement representation.
+    hi = W(U(hi) + U(v >> halfBits));
+    lo = U(lo + (U(v) & halfMask));
+}
+
+    // Sums the elements of v.
+struct sum_kernel
+{
+    template <typename V>
+    static SLOWMATH_DETAIL_FORCEINLINE triple_word<wide_lane_t<V>>
+    invoke_0(std::true_type /*isNarrow*/, V const* v, std::size_t n)
+    {
+        using W = wide_lane_t<V>;
+
+        auto acc = triple_word<W>{ };
+        for (std::size_t i0 = 0; i0 < n; i0 += reduce_block_size)
+        {
+            std::size_t i1 = n - i0 > reduce_block_size ? i0 + reduce_block_size : n;
+            W sum = 0;
+            for (std::size_t i = i0; i != i1; ++i)
+            {
+                sum = W(sum + W(v[i]));
+            }
+            detail::accumulate(acc, detail::widen_lane(sum));
+        }
+        return acc;
+    }
+    template <typename V>
+    static SLOWMATH_DETAIL_FORCEINLINE triple_word<wide_lane_t<V>>
+    invoke_0(std::false_type /*isNarrow*/, V const* v, std::size_t n)
+    {
+        using W = wide_lane_t<V>;
+        using U = make_unsigned_t<W>;
+
+        auto acc = triple_word<W>{ };
+        for (std::size_t i0 = 0; i0 < n; i0 += reduce_block_size)
+        {
+            std::size_t i1 = n - i0 > reduce_block_size ? i0 + reduce_block_size : n;
+            W hi = 0;
+            U lo = 0;
+            for (std::size_t i = i0; i != i1; ++i)
+            {
+                detail::accumulate_halves(hi, lo, W(v[i]));
+            }
+            detail::accumulate(acc, detail::combine_halves(hi, lo));
+        }
+        return acc;
+    }
+    template <typename V>
+    static SLOWMATH_DETAIL_FORCEINLINE triple_word<wide_lane_t<V>>
+    invoke(V const* v, std::size_t n)
+    {
+        return invoke_0(std::integral_constant<bool, (sizeof(V) < sizeof(std::uint64_t))>{ }, v, n);
+    }
+};
+
+    // Sums the products of the corresponding elements of a and b.
+struct dot_kernel
+{
+    template <typename V, typename A, typename B>
+    static SLOWMATH_DETAIL_FORCEINLINE triple_word<wide_lane_t<V>>
+    invoke_0(std::true_type /*isNarrow*/, A const* a, B const* b, std::size_t n)
+    {
+        using W = wide_lane_t<V>;
+        using U = make_unsigned_t<W>;
+
+            // The product of two 32-bit values is representable by a 64-bit value.
+        auto acc = triple_word<W>{ };
+        for (std::size_t i0 = 0; i0 < n; i0 += reduce_block_size)
+        {
+            std::size_t i1 = n - i0 > reduce_block_size ? i0 + reduce_block_size : n;
+            W hi = 0;
+            U lo = 0;
+            for (std::size_t i = i0; i != i1; ++i)
+            {
+                detail::accumulate_halves(hi, lo, W(W(V(a[i])) * W(V(b[i]))));
+            }
+            detail::accumulate(acc, detail::combine_halves(hi, lo));
+        }
+        return acc;
+    }
+    template <typename V, typename A, typename B>
+    static SLOWMATH_DETAIL_FORCEINLINE triple_word<wide_lane_t<V>>
+    invoke_0(std::false_type /*isNarrow*/, A const* a, B const* b, std::size_t n)
+    {
+        using W = wide_lane_t<V>;
+        using U = make_unsigned_t<W>;
+
+            // The 128-bit product of two 64-bit values is split into four 32-bit parts, which are summed separately.
+        auto acc = triple_word<W>{ };
+        for (std::size_t i0 = 0; i0 < n; i0 += reduce_block_size)
+        {
+            std::size_t i1 = n - i0 > reduce_block_size ? i0 + reduce_block_size : n;
+            W hiHi = 0;
+            U hiLo = 0;
+            U loHi = 0;
+            U loLo = 0;
+            for (std::size_t i = i0; i != i1; ++i)
+            {
+                auto product = detail::widening_multiply<W>(W(V(a[i])), W(V(b[i])));
+                detail::accumulate_halves(hiHi, hiLo, detail::high_word<W>(product));
+                detail::accumulate_halves(loHi, loLo, U(detail::truncate<W>(product)));
+            }
+            auto lo = detail::combine_halves(loHi, loLo);
+            detail::accumulate(acc, { W(lo.hi), lo.lo });
+            detail::accumulate_high(acc, detail::combine_halves(hiHi, hiLo));
+        }
+        return acc;
+    }
+    template <typename A, typename B>
+    static SLOWMATH_DETAIL_FORCEINLINE triple_word<wide_lane_t<common_integral_value_type<A, B>>>
+    invoke(A const* a, B const* b, std::size_t n)
+    {
+        using V = common_integral_value_type<A, B>;
+
+        return invoke_0<V>(std::integral_constant<bool, (sizeof(V) < sizeof(std::uint64_t))>{ }, a, b, n);
+    }
+};
+
+    // Multiplies the magnitudes of the elements of v in independent lanes, and records whether any of the elements is zero, the
+    // parity of the number of negative elements, and whether any lane overflowed. Because all factors of a non-zero product have
+    // a magnitude of at least 1, the magnitude of the product is not representable if any partial product overflows. Once a
+    // block of elements has overflowed, the remaining elements are thus only checked for zeros and negative values.
+template <typename V>
+struct product_state
+{
+    make_unsigned_t<V> magnitude;
+    bool zero;
+    bool negative;
+    bool overflow;
+};
+struct product_kernel
+{
+    template <typename V>
+    static SLOWMATH_DETAIL_FORCEINLINE product_state<V>
+    invoke(V const* v, std::size_t n)
+    {
+        using U = make_unsigned_t<V>;
+
+            // The multiplication of 64-bit operands cannot be vectorized, so additional lanes would only add overhead.
+        constexpr std::size_t numLanes = sizeof(V) > sizeof(std::uint32_t) ? 1 : 8;
+        constexpr std::size_t blockSize = 256;
+
+        U magnitudes[numLanes];
+        for (std::size_t j = 0; j != numLanes; ++j)
+        {
+            magnitudes[j] = 1;
+        }
+        U zero = 0;
+        U negative = 0;
+        U overflow = 0;
+        std::size_t i0 = 0;
+        for (; n - i0 >= blockSize && overflow == 0; i0 += blockSize)
+        {
+            for (std::size_t i = i0; i != i0 + blockSize; i += numLanes)
+            {
+                for (std::size_t j = 0; j != numLanes; ++j)
+                {
+                    V x = v[i + j];
+                    U m = detail::magnitude(x);
+                    auto r = detail::multiply_wrapping(magnitudes[j], m);
+                    magnitudes[j] = r.value;
+                    overflow |= U(r.overflow);
+                    zero |= U(m == 0);
+                    negative ^= U(detail::is_negative(x));
+                }
+            }
+        }
+        if (overflow != 0)
+        {
+            for (; i0 != n; ++i0)
+            {
+                zero |= U(v[i0] == 0);
+                negative ^= U(detail::is_negative(v[i0]));
+            }
+        }
+        for (; i0 != n; ++i0)
+        {
+            V x = v[i0];
+            U m = detail::magnitude(x);
+            auto r = detail::multiply_wrapping(magnitudes[0], m);
+            magnitudes[0] = r.value;
+            overflow |= U(r.overflow);
+            zero |= U(m == 0);
+            negative ^= U(detail::is_negative(x));
+        }
+        for (std::size_t j = 1; j != numLanes; ++j)
+        {
+            auto r = detail::multiply_wrapping(magnitudes[0], magnitudes[j]);
+            magnitudes[0] = r.value;
+            overflow |= U(r.overflow);
+        }
+        return { magnitudes[0], zero != 0, negative != 0, overflow != 0 };
+    }
+};
+
+
+    // Adds the value of w to the accumulator.
+template <typename V>
+constexpr void
+accumulate(triple_word<V>& acc, triple_word<V> const& w)
+{
+    using U = make_unsigned_t<V>;
+
+        // This assumes a two's complement representation.
+    U lo = U(acc.lo + w.lo);
+    U carry0 = lo < w.lo ? 1 : 0;
+    U mid0 = U(acc.mid + w.mid);
+    U carry1 = mid0 < acc.mid ? 1 : 0;
+    U mid = U(mid0 + carry0);
+    U carry2 = mid < mid0 ? 1 : 0;
+    acc = { V(U(U(acc.hi) + U(w.hi) + carry1 + carry2)), mid, lo };
+}
+
+    // Multiplies the accumulated product by the product recorded in s.
+template <typename V>
+constexpr void
+accumulate(product_state<V>& acc, product_state<V> const& s)
+{
+    auto r = detail::multiply_wrapping(acc.magnitude, s.magnitude);
+    acc = { r.value, acc.zero || s.zero, acc.negative != s.negative, acc.overflow || s.overflow || r.overflow };
+}
+
+template <typename EH, typename V, typename W>
+result_t<EH, V>
+sum_result(triple_word<W> const& acc)
+{
+    SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(detail::triple_word_fits<V>(acc), detail::triple_word_is_negative(acc));
+    return EH::make_result(V(acc.lo));
+}
+
+template <typename EH, typename V>
+result_t<EH, V>
+product_result(product_state<V> const& state)
+{
+    using U = make_unsigned_t<V>;
+
+    if (state.zero) return EH::make_result(V(0));
+    U bound = state.negative ? U(-U(min_v<V>)) : U(max_v<V>);
+    SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(!state.overflow && state.magnitude <= bound, state.negative);
+    return EH::make_result(V(state.negative ? U(-state.magnitude) : state.magnitude));
+}
+
+
+template <typename EH, typename V>
+result_t<EH, V>
+sum(V const* v, std::size_t n)
+{
+    static_assert(sizeof(V) <= sizeof(std::uint64_t), "reductions support integral types of up to 64 bits");
+
+    return detail::sum_result<EH, V>(detail::invoke_kernel<sum_kernel>(v, n));
+}
+
+template <typename EH, typename V, typename A, typename B>
+result_t<EH, V>
+dot(A const* a, B const* b, std::size_t n)
+{
+    static_assert(sizeof(V) <= sizeof(std::uint64_t), "reductions support integral types of up to 64 bits");
+
+    return detail::sum_result<EH, V>(detail::invoke_kernel<dot_kernel>(a, b, n));
+}
+
+template <typename EH, typename V>
+result_t<EH, V>
+product(V const* v, std::size_t n)
+{
+    static_assert(sizeof(V) <= sizeof(std::uint64_t), "reductions support integral types of up to 64 bits");
+
+    return detail::product_result<EH>(detail::invoke_kernel<product_kernel>(v, n));
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# pragma warning(pop)
+#endif // defined(_MSC_VER) && !defined(__clang__)
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_REDUCE_HPP_
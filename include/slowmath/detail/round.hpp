@@ -3,12 +3,20 @@
 #define INCLUDED_SLOWMATH_DETAIL_ROUND_HPP_
 
 
-#include <slowmath/detail/type_traits.hpp>  // for max_v<>, common_integral_value_type<>, result_t<>
-#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK()
+#include <cstdint>      // for uint64_t
+#include <type_traits>  // for integral_constant<>
+
+#include <slowmath/detail/type_traits.hpp>  // for min_v<>, max_v<>, make_unsigned_t<>, common_integral_value_type<>, result_t<>, is_power_of_two_constant<>, wider_type<>, double_width_type<>, is_double_word<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_OVERFLOW_CHECK(), SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(), ignore_error_handler, wrapping_result<>
+#include <slowmath/detail/arithmetic.hpp>   // for can_divide_overflow<>, magnitude(), is_negative()
+#include <slowmath/detail/intrinsics.hpp>   // for is_constant_evaluated(), multiply_double_word_u64(), divide_double_word_u64()
+#include <slowmath/detail/double-word.hpp>  // for multiply_double_word(), divide_double_word()
 
 
 #if defined(_MSC_VER) && !defined(__clang__)
 # pragma warning(push)
+# pragma warning(disable: 4127) // conditional expression is constant
+# pragma warning(disable: 4146) // unary minus operator applied to unsigned type, result still unsigned
 # pragma warning(disable: 4702) // unreachable code
 #endif // defined(_MSC_VER) && !defined(__clang__)
 
@@ -20,55 +28,300 @@ namespace detail
 {
 
 
-    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
-template <typename X, typename D>
-constexpr common_integral_value_type<X, D>
+    // The built-in division truncates towards zero. For signed operands, we obtain the rounded results from the truncated quotient
+    // q and remainder r = n - q ∙ d with the identities
+    //
+    //     ⌊n ÷ d⌋ = q - 1   if r ≠ 0 and r and d have different signs, otherwise q ,
+    //     ⌈n ÷ d⌉ = q + 1   if r ≠ 0 and r and d have identical signs, otherwise q .
+    //
+    // The corrections are computed arithmetically from the comparison results rather than with branches, which also lets the compiler
+    // vectorize loops over these functions. For unsigned operands, the corrections reduce to 0 and r ≠ 0, respectively.
+template <typename V>
+constexpr V
+floor_correction(V r, V d)
+{
+    return V(V(r != 0) & V(detail::is_negative(V(r ^ d))));
+}
+template <typename V>
+constexpr V
+ceil_correction(V r, V d)
+{
+    return V(V(r != 0) & V(!detail::is_negative(V(r ^ d))));
+}
+
+
+    // For a divisor d = 2ᵏ known at compile time, rounding amounts to masking, and division amounts to shifting. In a two's complement
+    // representation, masking off the low bits rounds towards negative infinity also for negative numbers.
+
+
+    // Computes ⌊x ÷ d⌋ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+template <typename EH, typename X, typename D>
+constexpr result_t<EH, common_integral_value_type<X, D>>
+floori_0(std::false_type /*isPowerOfTwoConstant*/, X x, D d)
+{
+    using V = common_integral_value_type<X, D>;
+
+        // For d > 0, the remainder r has the sign of x, and x - r is x rounded towards zero.
+    V r = V(x % d);
+    V t = V(x - r);
+    bool negative = detail::is_negative(r);
+    SLOWMATH_DETAIL_SIGNED_OVERFLOW_CHECK(!negative || t >= min_v<V> + d, true);
+    return EH::make_result(V(t - (d & -V(negative))));
+}
+template <typename EH, typename X, typename D>
+constexpr result_t<EH, common_integral_value_type<X, D>>
+floori_0(std::true_type /*isPowerOfTwoConstant*/, X x, D)
+{
+    using V = common_integral_value_type<X, D>;
+
+        // Cannot overflow because min_v<V> is a multiple of d.
+    constexpr V mask = V(D::value - 1);
+    return EH::make_result(V(x & ~mask));
+}
+template <typename EH, typename X, typename D>
+constexpr result_t<EH, common_integral_value_type<X, D>>
 floori(X x, D d)
 {
-    return x - x % d;
+    return detail::floori_0<EH>(is_power_of_two_constant<D>{ }, x, d);
 }
 
 
-    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
+    // Computes ⌈x ÷ d⌉ ∙ d for x ∊ ℤ, d ∊ ℕ, d ≠ 0.
+template <typename EH, typename X, typename D>
+constexpr result_t<EH, common_integral_value_type<X, D>>
+ceili_0(std::false_type /*isPowerOfTwoConstant*/, X x, D d)
+{
+    using V = common_integral_value_type<X, D>;
+
+        // For d > 0, the remainder r has the sign of x, and x - r is x rounded towards zero.
+    V r = V(x % d);
+    V t = V(x - r);
+    bool positive = r > 0;
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(!positive || t <= max_v<V> - d);
+    return EH::make_result(V(t + (d & -V(positive))));
+}
+template <typename EH, typename X, typename D>
+constexpr result_t<EH, common_integral_value_type<X, D>>
+ceili_0(std::true_type /*isPowerOfTwoConstant*/, X x, D)
+{
+    using V = common_integral_value_type<X, D>;
+
+    constexpr V mask = V(D::value - 1);
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(x <= max_v<V> - mask);
+    return EH::make_result(V((x + mask) & ~mask));
+}
 template <typename EH, typename X, typename D>
 constexpr result_t<EH, common_integral_value_type<X, D>>
 ceili(X x, D d)
+{
+    return detail::ceili_0<EH>(is_power_of_two_constant<D>{ }, x, d);
+}
+
+    // Computes ⌈x ÷ d⌉ ∙ d modulo 2ᴺ for x ∊ ℤ, d ∊ ℕ, d ≠ 0 and whether the result is not representable, without branching; cf.
+    // the wrapping operations in "arithmetic.hpp".
+template <typename X, typename D>
+constexpr wrapping_result<common_integral_value_type<X, D>>
+ceili_wrapping_0(std::false_type /*isPowerOfTwoConstant*/, X x, D d)
 {
     using V = common_integral_value_type<X, D>;
+    using U = make_unsigned_t<V>;
 
-        // We have the following identities:
-        //
-        //     x = ⌊x ÷ d⌋ ∙ d + x mod d
-        //     ⌈x ÷ d⌉ = ⌊(x + d - 1) ÷ d⌋ = ⌊(x - 1) ÷ d⌋ + 1
-        //
-        // Assuming x ≠ 0, we can derive the form
-        //
-        //     ⌈x ÷ d⌉ ∙ d = x + d - (x - 1) mod d - 1 .
+    V vx = V(x);
+    V vd = V(d);
+    V r = V(vx % vd);
+    V t = V(vx - r);
+    bool positive = r > 0;
+    return { V(U(t) + U(vd & -V(positive))), positive && t > V(max_v<V> - vd) };
+}
+template <typename X, typename D>
+constexpr wrapping_result<common_integral_value_type<X, D>>
+ceili_wrapping_0(std::true_type /*isPowerOfTwoConstant*/, X x, D)
+{
+    using V = common_integral_value_type<X, D>;
+    using U = make_unsigned_t<V>;
 
-    if (x == 0) return EH::make_result(V(0));
-    V dx = d - (x - 1) % d - 1;
-    SLOWMATH_DETAIL_OVERFLOW_CHECK(x <= max_v<V> - dx);
-    return EH::make_result(V(x + dx));
+    constexpr V mask = V(D::value - 1);
+    V vx = V(x);
+    return { V(U(U(vx) + U(mask)) & U(~U(mask))), vx > V(max_v<V> - mask) };
+}
+template <typename X, typename D>
+constexpr wrapping_result<common_integral_value_type<X, D>>
+ceili_wrapping(X x, D d)
+{
+    return detail::ceili_wrapping_0(is_power_of_two_constant<D>{ }, x, d);
 }
 
 
-    // Computes ⌊n ÷ d⌋ for n ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
-template <typename N, typename D>
-constexpr common_integral_value_type<N, D>
+    // Computes ⌊n ÷ d⌋ for n, d ∊ ℤ, d ≠ 0.
+template <typename EH, typename N, typename D>
+constexpr result_t<EH, common_integral_value_type<N, D>>
+ratio_floori_0(std::false_type /*isPowerOfTwoConstant*/, N n, D d)
+{
+    using V = common_integral_value_type<N, D>;
+
+    if (can_divide_overflow<V, D>::value) // should be `if constexpr` in C++17
+    {
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(!(n == min_v<V> && d == -1));
+    }
+    V q = V(n / d);
+    V r = V(n % d);
+    return EH::make_result(V(q - detail::floor_correction(r, V(d))));
+}
+template <typename EH, typename N, typename D>
+constexpr result_t<EH, common_integral_value_type<N, D>>
+ratio_floori_0(std::true_type /*isPowerOfTwoConstant*/, N n, D)
+{
+    using V = common_integral_value_type<N, D>;
+    using U = make_unsigned_t<V>;
+
+        // For negative n, we have ⌊n ÷ d⌋ = -⌊(-n - 1) ÷ d⌋ - 1, where -n - 1 = ~n is non-negative, so we can divide an unsigned
+        // number and need not rely on the implementation-defined behavior of right-shifting negative numbers.
+    V s = V(-V(detail::is_negative(V(n))));
+    return EH::make_result(V(s ^ V(U(n ^ s) / U(D::value))));
+}
+template <typename EH, typename N, typename D>
+constexpr result_t<EH, common_integral_value_type<N, D>>
 ratio_floori(N n, D d)
 {
-    return n / d;
+    return detail::ratio_floori_0<EH>(is_power_of_two_constant<D>{ }, n, d);
 }
 
 
-    // Computes ⌈n ÷ d⌉ for n ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
+    // Computes ⌈n ÷ d⌉ for n, d ∊ ℤ, d ≠ 0.
+template <typename EH, typename N, typename D>
+constexpr result_t<EH, common_integral_value_type<N, D>>
+ratio_ceili_0(std::false_type /*isPowerOfTwoConstant*/, N n, D d)
+{
+    using V = common_integral_value_type<N, D>;
+
+    if (can_divide_overflow<V, D>::value) // should be `if constexpr` in C++17
+    {
+        SLOWMATH_DETAIL_OVERFLOW_CHECK(!(n == min_v<V> && d == -1));
+    }
+    V q = V(n / d);
+    V r = V(n % d);
+    return EH::make_result(V(q + detail::ceil_correction(r, V(d)))); // overflow-safe
+}
+template <typename EH, typename N, typename D>
+constexpr result_t<EH, common_integral_value_type<N, D>>
+ratio_ceili_0(std::true_type /*isPowerOfTwoConstant*/, N n, D d)
+{
+    using V = common_integral_value_type<N, D>;
+    using U = make_unsigned_t<V>;
+
+    constexpr U mask = U(D::value - 1);
+    V q = detail::ratio_floori_0<ignore_error_handler>(std::true_type{ }, n, d);
+    return EH::make_result(V(q + ((U(n) & mask) != 0 ? 1 : 0))); // overflow-safe
+}
+template <typename EH, typename N, typename D>
+constexpr result_t<EH, common_integral_value_type<N, D>>
+ratio_ceili(N n, D d)
+{
+    return detail::ratio_ceili_0<EH>(is_power_of_two_constant<D>{ }, n, d);
+}
+
+
+    // Computes n mod d for n, d ∊ ℤ, d ≠ 0, such that 0 ≤ n mod d < |d|.
 template <typename N, typename D>
 constexpr common_integral_value_type<N, D>
-ratio_ceili(N n, D d)
+modulo_euclid(N n, D d)
+{
+    using V = common_integral_value_type<N, D>;
+    using U = make_unsigned_t<V>;
+
+        // The built-in remainder has the sign of n. The result is representable even for d = min_v<V>, and n mod -1 = 0 is computed
+        // as n mod 1 because n % -1 is undefined for n = min_v<V>.
+    V d1 = can_divide_overflow<V, D>::value && V(d) == V(-1) ? V(1) : V(d);
+    V r = V(n % d1);
+    return V(U(r) + (detail::magnitude(d1) & U(-U(detail::is_negative(r)))));
+}
+
+
+    // Computes ⌊a ∙ b ÷ d⌋ (or ⌈a ∙ b ÷ d⌉ if `RoundUp` is true) for a,b ∊ ℕ₀, d ∊ ℕ, d ≠ 0.
+    //
+    // The product is computed in the wider type, or as a double word if there is no wider type, so it cannot overflow, and we only
+    // need to check that the quotient is representable. The quotient of a double-word product fits into a single word iff the high
+    // word of the product is less than d. On x86-64, the double-word division of 64-bit operands is done with a single `div`
+    // instruction rather than with a call to a 128-bit division routine.
+template <typename EH, typename V, bool RoundUp>
+constexpr result_t<EH, V>
+muldivi_round(make_unsigned_t<V> quotient, make_unsigned_t<V> remainder)
+{
+    using U = make_unsigned_t<V>;
+
+    U roundUp = RoundUp && remainder != 0 ? 1 : 0;
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(quotient <= U(max_v<V>) - roundUp);
+    return EH::make_result(V(quotient + roundUp));
+}
+template <typename EH, typename V, bool RoundUp>
+constexpr result_t<EH, V>
+muldivi_0(std::false_type /*isDoubleWord*/, V a, V b, V d)
+{
+    using W = wider_type<V>;
+
+    W product = W(W(a) * W(b));
+    W quotient = RoundUp
+        ? detail::ratio_ceili<ignore_error_handler>(product, W(d))
+        : detail::ratio_floori<ignore_error_handler>(product, W(d));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(quotient <= W(max_v<V>));
+    return EH::make_result(V(quotient));
+}
+template <typename EH, typename V, bool RoundUp>
+constexpr result_t<EH, V>
+muldivi_0(std::true_type /*isDoubleWord*/, V a, V b, V d)
+{
+    using U = make_unsigned_t<V>;
+
+    auto product = detail::multiply_double_word(U(a), U(b));
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(product.hi < U(d));
+    auto qr = detail::divide_double_word(product, U(d));
+    return detail::muldivi_round<EH, V, RoundUp>(qr.quotient, qr.remainder);
+}
+#if defined(SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS)
+template <typename EH, typename V, bool RoundUp>
+result_t<EH, V>
+muldivi_runtime(std::true_type /*isDoubleWordIntrinsic*/, V a, V b, V d)
+{
+    std::uint64_t hi = 0;
+    std::uint64_t lo = detail::multiply_double_word_u64(std::uint64_t(a), std::uint64_t(b), hi);
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(hi < std::uint64_t(d));
+    std::uint64_t remainder = 0;
+    std::uint64_t quotient = detail::divide_double_word_u64(hi, lo, std::uint64_t(d), remainder);
+    return detail::muldivi_round<EH, V, RoundUp>(quotient, remainder);
+}
+template <typename EH, typename V, bool RoundUp>
+result_t<EH, V>
+muldivi_runtime(std::false_type /*isDoubleWordIntrinsic*/, V a, V b, V d)
+{
+    return detail::muldivi_0<EH, V, RoundUp>(is_double_word<double_width_type<V>>{ }, a, b, d);
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS)
+template <typename EH, bool RoundUp, typename A, typename B, typename D>
+constexpr result_t<EH, common_integral_value_type<A, B, D>>
+muldivi(A a, B b, D d)
+{
+    using V = common_integral_value_type<A, B, D>;
+
+#if defined(SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS)
+    if (!detail::is_constant_evaluated())
+    {
+        return detail::muldivi_runtime<EH, V, RoundUp>(std::integral_constant<bool, sizeof(V) == sizeof(std::uint64_t)>{ }, V(a), V(b), V(d));
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_DIVIDE_DOUBLE_WORD_INTRINSICS)
+    return detail::muldivi_0<EH, V, RoundUp>(is_double_word<double_width_type<V>>{ }, V(a), V(b), V(d));
+}
+
+template <typename EH, typename A, typename B, typename D>
+constexpr result_t<EH, common_integral_value_type<A, B, D>>
+muldiv_floori(A a, B b, D d)
+{
+    return detail::muldivi<EH, false>(a, b, d);
+}
+template <typename EH, typename A, typename B, typename D>
+constexpr result_t<EH, common_integral_value_type<A, B, D>>
+muldiv_ceili(A a, B b, D d)
 {
-    return n != 0
-        ? (n - 1) / d + 1 // overflow-safe
-        : 0;
+    return detail::muldivi<EH, true>(a, b, d);
 }
 
 
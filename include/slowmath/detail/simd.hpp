@@ -0,0 +1,263 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_SIMD_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_SIMD_HPP_
+
+
+#include <cstddef>  // for size_t
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_CPP17_OR_GREATER
+
+    // The overloads for simd vectors are available if the standard library provides `std::experimental::simd<>` (Parallelism TS 2),
+    // which requires C++17.
+#if gsl_CPP17_OR_GREATER && defined(__has_include) && !defined(__CUDA_ARCH__)
+# if __has_include(<experimental/simd>)
+#  include <experimental/simd>
+#  if defined(__cpp_lib_experimental_parallel_simd)
+#   define SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD 1
+#  endif // defined(__cpp_lib_experimental_parallel_simd)
+# endif // __has_include(<experimental/simd>)
+#endif // gsl_CPP17_OR_GREATER && defined(__has_include) && !defined(__CUDA_ARCH__)
+#if !defined(SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD)
+# define SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD 0
+#endif // !defined(SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD)
+
+#if SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD
+
+#include <slowmath/detail/type_traits.hpp>  // for integral_value_type<>, result_t<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_FORCEINLINE, SLOWMATH_DETAIL_OVERFLOW_CHECK(), wrapping_result<>, saturate_error_handler
+#include <slowmath/detail/arithmetic.hpp>   // for add_saturating(), subtract_saturating(), multiply_saturating()
+#include <slowmath/detail/bits.hpp>         // for shift_left()
+#include <slowmath/detail/round.hpp>        // for ceili()
+#include <slowmath/detail/batch.hpp>        // for unary_batch<>, binary_batch<>, scalar_batch<>, *_wrapping_op
+
+#if SLOWMATH_OVERFLOW_TELEMETRY
+# include <slowmath/detail/telemetry.hpp>  // for source_location, record_overflow_at_site()
+#endif // SLOWMATH_OVERFLOW_TELEMETRY
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+namespace stdx = std::experimental;
+
+
+    // The lane-wise operations copy the lanes of the operands to arrays and apply the scalar wrapping operations to the array
+    // elements in a loop with a constant trip count. The wrapping operations do not branch, so the compiler vectorizes the loop,
+    // and the results and the overflow flags are computed in vector registers. Overflow is then checked once for the entire vector.
+
+template <typename T, typename Abi>
+struct simd_lanes
+{
+    alignas(stdx::memory_alignment_v<stdx::simd<T, Abi>>) T data[stdx::simd_size_v<T, Abi>];
+
+    explicit simd_lanes(stdx::simd<T, Abi> const& v)
+    {
+        v.copy_to(data, stdx::vector_aligned);
+    }
+};
+
+    // The lane-wise results modulo 2ᴺ along with a mask of the lanes for which the infinitely precise result is not representable.
+template <typename T, typename Abi>
+struct simd_wrapping_result
+{
+    stdx::simd<T, Abi> value;
+    typename stdx::simd<T, Abi>::mask_type overflow;
+};
+
+template <typename T, typename Abi, typename F>
+SLOWMATH_DETAIL_FORCEINLINE simd_wrapping_result<T, Abi>
+transform_lanes(F f)
+{
+    constexpr std::size_t n = stdx::simd_size_v<T, Abi>;
+
+        // The overflow flags are stored as elements of type T so that the mask can be computed with a single vector comparison.
+    alignas(stdx::memory_alignment_v<stdx::simd<T, Abi>>) T values[n];
+    alignas(stdx::memory_alignment_v<stdx::simd<T, Abi>>) T overflow[n];
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        wrapping_result<T> r = f(i);
+        values[i] = r.value;
+        overflow[i] = T(r.overflow);
+    }
+    return { stdx::simd<T, Abi>(values, stdx::vector_aligned), stdx::simd<T, Abi>(overflow, stdx::vector_aligned) != T(0) };
+}
+
+template <typename T, typename Abi, typename F>
+SLOWMATH_DETAIL_FORCEINLINE stdx::simd<T, Abi>
+map_lanes(F f)
+{
+    constexpr std::size_t n = stdx::simd_size_v<T, Abi>;
+
+    alignas(stdx::memory_alignment_v<stdx::simd<T, Abi>>) T values[n];
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        values[i] = f(i);
+    }
+    return stdx::simd<T, Abi>(values, stdx::vector_aligned);
+}
+
+
+    // Applies the wrapping operation `F` to the lanes of a vector, to the corresponding lanes of two vectors, or to the lanes of a
+    // vector and a scalar.
+template <typename F, typename T, typename Abi>
+SLOWMATH_DETAIL_FORCEINLINE simd_wrapping_result<T, Abi>
+transform_simd(stdx::simd<T, Abi> const& v)
+{
+    auto lv = simd_lanes<T, Abi>(v);
+    return detail::transform_lanes<T, Abi>(unary_batch<F, T>{ lv.data });
+}
+template <typename F, typename T, typename Abi>
+SLOWMATH_DETAIL_FORCEINLINE simd_wrapping_result<T, Abi>
+transform_simd(stdx::simd<T, Abi> const& a, stdx::simd<T, Abi> const& b)
+{
+    auto la = simd_lanes<T, Abi>(a);
+    auto lb = simd_lanes<T, Abi>(b);
+    return detail::transform_lanes<T, Abi>(binary_batch<F, T, T>{ la.data, lb.data });
+}
+template <typename F, typename T, typename Abi, typename P>
+SLOWMATH_DETAIL_FORCEINLINE simd_wrapping_result<T, Abi>
+transform_simd(stdx::simd<T, Abi> const& x, P p)
+{
+    auto lx = simd_lanes<T, Abi>(x);
+    return detail::transform_lanes<T, Abi>(scalar_batch<F, T, P>{ lx.data, p });
+}
+
+    // Like `transform_simd()`, but applies the saturating operation `F`, which returns the result value.
+template <typename F, typename T, typename Abi>
+SLOWMATH_DETAIL_FORCEINLINE stdx::simd<T, Abi>
+map_simd(stdx::simd<T, Abi> const& a, stdx::simd<T, Abi> const& b)
+{
+    auto la = simd_lanes<T, Abi>(a);
+    auto lb = simd_lanes<T, Abi>(b);
+    return detail::map_lanes<T, Abi>(binary_batch<F, T, T>{ la.data, lb.data });
+}
+template <typename F, typename T, typename Abi, typename P>
+SLOWMATH_DETAIL_FORCEINLINE stdx::simd<T, Abi>
+map_simd(stdx::simd<T, Abi> const& x, P p)
+{
+    auto lx = simd_lanes<T, Abi>(x);
+    return detail::map_lanes<T, Abi>(scalar_batch<F, T, P>{ lx.data, p });
+}
+
+    // The second operand of `shift_left()` and `ceili()` may be a vector or a scalar.
+template <typename P, typename T, typename Abi> struct simd_operand_value_type_ { using type = integral_value_type<P>; };
+template <typename T, typename Abi> struct simd_operand_value_type_<stdx::simd<T, Abi>, T, Abi> { using type = T; };
+template <typename P, typename T, typename Abi> using simd_operand_value_type = typename simd_operand_value_type_<P, T, Abi>::type;
+
+template <typename T, typename Abi>
+bool
+all_lanes_nonnegative(stdx::simd<T, Abi> const& v)
+{
+    return stdx::all_of(v >= T(0));
+}
+template <typename V>
+constexpr bool
+all_lanes_nonnegative(V v)
+{
+    return v >= 0;
+}
+template <typename T, typename Abi>
+bool
+all_lanes_positive(stdx::simd<T, Abi> const& v)
+{
+    return stdx::all_of(v > T(0));
+}
+template <typename V>
+constexpr bool
+all_lanes_positive(V v)
+{
+    return v > 0;
+}
+
+    // Reports an overflow in any lane of `r` with the error handler `EH`. The overflow mask is OR-reduced, and `EH::check()` is
+    // called once for the entire vector, so the error handler need not be aware of simd vectors. If an error is returned, e.g. by
+    // `try_error_handler`, the result value is unspecified.
+template <typename EH, typename T, typename Abi>
+SLOWMATH_DETAIL_FORCEINLINE result_t<EH, stdx::simd<T, Abi>>
+check_lanes(simd_wrapping_result<T, Abi> const& r)
+{
+    SLOWMATH_DETAIL_OVERFLOW_CHECK(stdx::none_of(r.overflow));
+    return EH::make_result(r.value);
+}
+
+#if SLOWMATH_OVERFLOW_TELEMETRY
+    // Records an overflow event for the given source location if an overflow occurs in any lane.
+template <typename T, typename Abi>
+SLOWMATH_DETAIL_FORCEINLINE simd_wrapping_result<T, Abi>
+record_try_result(simd_wrapping_result<T, Abi> const& r, source_location site)
+{
+    if (SLOWMATH_DETAIL_UNLIKELY(stdx::any_of(r.overflow))) detail::record_overflow_at_site(site);
+    return r;
+}
+#endif // SLOWMATH_OVERFLOW_TELEMETRY
+
+
+struct square_wrapping_op
+{
+    template <typename V>
+    static constexpr auto
+    invoke(V v)
+    {
+        return detail::multiply_wrapping(v, v);
+    }
+};
+
+struct add_saturating_op
+{
+    template <typename A, typename B>
+    static constexpr auto
+    invoke(A a, B b)
+    {
+        return detail::add_saturating(a, b);
+    }
+};
+struct subtract_saturating_op
+{
+    template <typename A, typename B>
+    static constexpr auto
+    invoke(A a, B b)
+    {
+        return detail::subtract_saturating(a, b);
+    }
+};
+struct multiply_saturating_op
+{
+    template <typename A, typename B>
+    static constexpr auto
+    invoke(A a, B b)
+    {
+        return detail::multiply_saturating(a, b);
+    }
+};
+struct shift_left_saturating_op
+{
+    template <typename X, typename S>
+    static constexpr auto
+    invoke(X x, S s)
+    {
+        return detail::shift_left<saturate_error_handler>(x, s);
+    }
+};
+struct ceili_saturating_op
+{
+    template <typename X, typename D>
+    static constexpr auto
+    invoke(X x, D d)
+    {
+        return detail::ceili<saturate_error_handler>(x, d);
+    }
+};
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+#endif // SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_SIMD_HPP_
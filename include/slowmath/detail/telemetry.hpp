@@ -0,0 +1,470 @@
+
+#ifndef INCLUDED_SLOWMATH_DETAIL_TELEMETRY_HPP_
+#define INCLUDED_SLOWMATH_DETAIL_TELEMETRY_HPP_
+
+
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <climits>  // for CHAR_BIT
+#include <cstdint>  // for uint64_t, uintptr_t
+#include <string>
+#include <ostream>
+#include <type_traits>   // for integral_constant<>
+#include <system_error>  // for errc, system_error, make_error_code()
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_HAVE_EXCEPTIONS
+
+#include <slowmath/detail/type_traits.hpp>  // for is_signed_v<>, make_unsigned_t<>, max_v<>
+#include <slowmath/detail/errors.hpp>       // for SLOWMATH_DETAIL_FORCEINLINE, SLOWMATH_DETAIL_NOINLINE_COLD, SLOWMATH_DETAIL_UNLIKELY(), arithmetic_result<>, arithmetic_operation, overflow_error
+
+
+#if defined(__GNUC__) || defined(__clang__)
+# define SLOWMATH_DETAIL_RETURN_ADDRESS()  __builtin_return_address(0)
+#elif defined(_MSC_VER)
+# define SLOWMATH_DETAIL_RETURN_ADDRESS()  _ReturnAddress()
+#else
+# define SLOWMATH_DETAIL_RETURN_ADDRESS()  nullptr
+#endif
+
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1926)
+# define SLOWMATH_DETAIL_BUILTIN_FILE()  __builtin_FILE()
+# define SLOWMATH_DETAIL_BUILTIN_LINE()  __builtin_LINE()
+#else
+# define SLOWMATH_DETAIL_BUILTIN_FILE()  nullptr
+# define SLOWMATH_DETAIL_BUILTIN_LINE()  0u
+#endif
+
+
+namespace slowmath
+{
+
+namespace detail
+{
+
+
+    // Overflow events are counted in per-thread hash tables with a fixed number of slots. A slot is only ever written by the
+    // thread which owns the table: the key is written first and then published by setting `used` with release semantics, and
+    // the counter is updated with relaxed loads and stores rather than atomic read-modify-write operations. Other threads may
+    // therefore read the tables at any time without synchronization beyond the acquire load of `used`.
+    //
+    // A table is allocated and registered in a lock-free list upon the first overflow in a thread. Tables are never freed, so
+    // the events recorded by threads which have exited remain part of the snapshot.
+
+constexpr std::size_t telemetry_table_size = 256;
+
+struct telemetry_slot
+{
+    std::atomic<bool> used;
+    void const* caller;
+    char const* file;
+    unsigned line;
+    std::atomic<std::uint64_t> count;
+};
+
+struct telemetry_table
+{
+    telemetry_slot slots[telemetry_table_size];
+    std::atomic<std::uint64_t> dropped;
+    telemetry_table* next;
+};
+
+inline std::atomic<telemetry_table*>&
+telemetry_tables() noexcept
+{
+    static std::atomic<telemetry_table*> head{ nullptr };
+    return head;
+}
+
+inline telemetry_table*
+register_telemetry_table()
+{
+    auto table = new telemetry_table{ };
+    auto& head = detail::telemetry_tables();
+    table->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(table->next, table, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+    return table;
+}
+
+inline telemetry_table&
+thread_telemetry_table()
+{
+    thread_local telemetry_table* table = detail::register_telemetry_table();
+    return *table;
+}
+
+inline std::size_t
+telemetry_hash(void const* caller, char const* file, unsigned line) noexcept
+{
+    auto key = std::uint64_t((reinterpret_cast<std::uintptr_t>(caller) >> 2) ^ (reinterpret_cast<std::uintptr_t>(file) >> 3) ^ line);
+    return std::size_t((key * 0x9E3779B97F4A7C15ull) >> 40);
+}
+
+inline void
+increment_relaxed(std::atomic<std::uint64_t>& counter) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+SLOWMATH_DETAIL_NOINLINE_COLD inline void
+record_overflow_at(void const* caller, char const* file, unsigned line)
+{
+    auto& table = detail::thread_telemetry_table();
+    std::size_t h = detail::telemetry_hash(caller, file, line);
+    for (std::size_t i = 0; i != telemetry_table_size; ++i)
+    {
+        auto& slot = table.slots[(h + i) % telemetry_table_size];
+        if (!slot.used.load(std::memory_order_relaxed))
+        {
+            slot.caller = caller;
+            slot.file = file;
+            slot.line = line;
+            slot.count.store(1, std::memory_order_relaxed);
+            slot.used.store(true, std::memory_order_release);
+            return;
+        }
+        if (slot.caller == caller && slot.file == file && slot.line == line)
+        {
+            detail::increment_relaxed(slot.count);
+            return;
+        }
+    }
+    detail::increment_relaxed(table.dropped);
+}
+
+    // Records an overflow event. The function is never inlined, so the return address identifies the function in which the
+    // overflow check was inlined, which is usually the caller of the arithmetic operation.
+SLOWMATH_DETAIL_NOINLINE_COLD inline void
+record_overflow(char const* file, unsigned line)
+{
+    detail::record_overflow_at(SLOWMATH_DETAIL_RETURN_ADDRESS(), file, line);
+}
+
+
+    // The source location of a call of a `try_*()` or `*_checked()` operation. If `SLOWMATH_OVERFLOW_TELEMETRY` is defined as 1,
+    // the operations take a trailing argument of this type which defaults to the location of the caller.
+struct source_location
+{
+    char const* file;
+    unsigned line;
+
+    static constexpr source_location
+    current(char const* file = SLOWMATH_DETAIL_BUILTIN_FILE(), unsigned line = SLOWMATH_DETAIL_BUILTIN_LINE()) noexcept
+    {
+        return { file, line };
+    }
+};
+
+    // The source location of a call site declared with `SLOWMATH_CALL_SITE()`, or no source location if `Site` is `void`.
+template <typename Site>
+struct call_site_location
+{
+    static constexpr char const* file(void) noexcept { return Site::file(); }
+    static constexpr unsigned line(void) noexcept { return Site::line(); }
+};
+template <>
+struct call_site_location<void>
+{
+    static constexpr char const* file(void) noexcept { return nullptr; }
+    static constexpr unsigned line(void) noexcept { return 0; }
+};
+
+    // Records an overflow event at the given source location. The return address identifies the function into which the
+    // operation was inlined.
+SLOWMATH_DETAIL_NOINLINE_COLD inline void
+record_overflow_at_site(source_location site)
+{
+    detail::record_overflow_at(SLOWMATH_DETAIL_RETURN_ADDRESS(), site.file, site.line);
+}
+
+template <typename T>
+constexpr SLOWMATH_DETAIL_FORCEINLINE arithmetic_result<T>
+record_try_result(arithmetic_result<T> result, source_location site)
+{
+    if (SLOWMATH_DETAIL_UNLIKELY(result.ec != std::errc{ })) detail::record_overflow_at_site(site);
+    return result;
+}
+template <typename V, V Value>
+constexpr SLOWMATH_DETAIL_FORCEINLINE std::integral_constant<V, Value>
+record_try_result(std::integral_constant<V, Value> result, source_location) noexcept
+{
+    return result;
+}
+
+#if gsl_HAVE_EXCEPTIONS
+[[noreturn]] SLOWMATH_DETAIL_NOINLINE_COLD inline void
+throw_recorded_error(arithmetic_operation operation, std::errc ec, source_location site)
+{
+    detail::record_overflow_at(SLOWMATH_DETAIL_RETURN_ADDRESS(), site.file, site.line);
+    if (ec == std::errc::value_too_large) throw overflow_error(operation);
+    throw std::system_error(std::make_error_code(ec));
+}
+
+[[noreturn]] inline void
+throw_overflow_error(arithmetic_operation operation, source_location site)
+{
+    detail::throw_recorded_error(operation, std::errc::value_too_large, site);
+}
+
+template <arithmetic_operation Operation, typename T>
+constexpr SLOWMATH_DETAIL_FORCEINLINE T
+checked_result(arithmetic_result<T> result, source_location site)
+{
+    if (SLOWMATH_DETAIL_UNLIKELY(result.ec != std::errc{ })) detail::throw_recorded_error(Operation, result.ec, site);
+    return result.value;
+}
+template <arithmetic_operation Operation, typename V, V Value>
+constexpr SLOWMATH_DETAIL_FORCEINLINE std::integral_constant<V, Value>
+checked_result(std::integral_constant<V, Value> result, source_location) noexcept
+{
+    return result;
+}
+
+    // Writing a telemetry file through a `std::ofstream` does not reliably set `errno`, so failures are reported with an
+    // explicit error code.
+[[noreturn]] SLOWMATH_DETAIL_NOINLINE_COLD inline void
+throw_telemetry_file_error(char const* path)
+{
+    throw std::system_error(std::make_error_code(std::errc::io_error), std::string("cannot write telemetry file '") + path + "'");
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    // The headroom profile keeps one record per call site, operation, and result type, which holds the largest number of bits
+    // required to represent a result plus 1 (so that 0 indicates that no result has been recorded). The record is registered in
+    // a lock-free list upon the first update.
+    //
+    // To keep the bookkeeping off the success path, a result is first compared with a bound, a constant-initialized static
+    // object which is the smallest power of 2 that exceeds the magnitudes of all results recorded so far. Only if the result
+    // reaches the bound, a function which is never inlined computes the number of bits and updates the counter and the bound
+    // with compare-and-swap loops. A profiled operation thus costs a relaxed load and a comparison, plus a shift and an
+    // exclusive or for signed types. For types wider than 64 bits, for which atomic operations may not be lock-free, the number
+    // of bits is computed and compared with the counter instead.
+struct headroom_site_record
+{
+    char const* name;
+    char const* file;
+    unsigned line;
+    arithmetic_operation operation;
+    bool isSigned;
+    unsigned char typeBits;
+    std::atomic<unsigned char> const* maxBitsPlusOne;
+    headroom_site_record* next;
+
+    headroom_site_record(char const* _name, char const* _file, unsigned _line, arithmetic_operation _operation, bool _isSigned, unsigned char _typeBits,
+        std::atomic<unsigned char> const* _maxBitsPlusOne) noexcept;
+};
+
+inline std::atomic<headroom_site_record*>&
+headroom_sites() noexcept
+{
+    static std::atomic<headroom_site_record*> head{ nullptr };
+    return head;
+}
+
+inline headroom_site_record::headroom_site_record(char const* _name, char const* _file, unsigned _line, arithmetic_operation _operation, bool _isSigned,
+    unsigned char _typeBits, std::atomic<unsigned char> const* _maxBitsPlusOne) noexcept
+    : name(_name), file(_file), line(_line), operation(_operation), isSigned(_isSigned), typeBits(_typeBits), maxBitsPlusOne(_maxBitsPlusOne)
+{
+    auto& head = detail::headroom_sites();
+    next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+    // Computes the number of significant bits of u.
+template <typename U>
+constexpr unsigned
+significant_bits(U u) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return sizeof(U) <= sizeof(unsigned long long)
+        ? (u == 0 ? 0u : unsigned(sizeof(unsigned long long) * CHAR_BIT - __builtin_clzll(static_cast<unsigned long long>(u))))
+        : (u >> (sizeof(U) * CHAR_BIT / 2) != 0
+            ? unsigned(sizeof(U) * CHAR_BIT / 2) + detail::significant_bits(static_cast<unsigned long long>(u >> (sizeof(U) * CHAR_BIT / 2)))
+            : detail::significant_bits(static_cast<unsigned long long>(u)));
+#else // defined(__GNUC__) || defined(__clang__)
+    unsigned result = 0;
+    while (u != 0)
+    {
+        u >>= 1;
+        ++result;
+    }
+    return result;
+#endif // defined(__GNUC__) || defined(__clang__)
+}
+
+    // Maps v to an unsigned magnitude whose significant bits are the bits required to represent v in its type, not counting the
+    // sign bit if the type is signed. Negative values are mapped to their one's complement.
+template <typename V>
+constexpr make_unsigned_t<V>
+headroom_magnitude_0(std::false_type /*isSigned*/, V v) noexcept
+{
+    return v;
+}
+template <typename V>
+constexpr make_unsigned_t<V>
+headroom_magnitude_0(std::true_type /*isSigned*/, V v) noexcept
+{
+    using U = make_unsigned_t<V>;
+
+    return U(v) ^ U(v >> (sizeof(V) * CHAR_BIT - 1));
+}
+template <typename V>
+constexpr make_unsigned_t<V>
+headroom_magnitude(V v) noexcept
+{
+    return detail::headroom_magnitude_0(std::integral_constant<bool, is_signed_v<V>>{ }, v);
+}
+
+    // Computes the number of bits required to represent v in its type, including the sign bit if the type is signed.
+template <typename V>
+constexpr unsigned
+required_bits(V v) noexcept
+{
+    return detail::significant_bits(detail::headroom_magnitude(v)) + (is_signed_v<V> ? 1 : 0);
+}
+
+template <typename Site, typename V, arithmetic_operation Operation>
+struct headroom_site
+{
+    using U = make_unsigned_t<V>;
+
+    static std::atomic<unsigned char>&
+    max_bits_plus_one() noexcept
+    {
+        static std::atomic<unsigned char> value{ 0 };
+        return value;
+    }
+
+        // 0 if no result has been recorded, otherwise 2ᵏ where k is the largest number of significant bits of a magnitude, or
+        // the largest value of `U` if k is the number of bits of `U`.
+    static std::atomic<U>&
+    bound() noexcept
+    {
+        static std::atomic<U> value{ 0 };
+        return value;
+    }
+
+    static SLOWMATH_DETAIL_NOINLINE_COLD void
+    update(unsigned char bitsPlusOne) noexcept
+    {
+        static headroom_site_record record(Site::name(), Site::file(), Site::line(), Operation,
+            is_signed_v<V>, static_cast<unsigned char>(sizeof(V) * CHAR_BIT), &max_bits_plus_one());
+
+        auto& maxBitsPlusOne = max_bits_plus_one();
+        auto current = maxBitsPlusOne.load(std::memory_order_relaxed);
+        while (bitsPlusOne > current && !maxBitsPlusOne.compare_exchange_weak(current, bitsPlusOne, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    static SLOWMATH_DETAIL_NOINLINE_COLD void
+    update_bound(U magnitude) noexcept
+    {
+        unsigned bits = detail::significant_bits(magnitude);
+        headroom_site::update(static_cast<unsigned char>(bits + (is_signed_v<V> ? 1 : 0) + 1));
+
+        U newBound = bits == sizeof(U) * CHAR_BIT ? max_v<U> : U(U(1) << bits);
+        auto& b = bound();
+        auto current = b.load(std::memory_order_relaxed);
+        while (newBound > current && !b.compare_exchange_weak(current, newBound, std::memory_order_relaxed))
+        {
+        }
+    }
+};
+
+template <typename Site, arithmetic_operation Operation, typename V>
+SLOWMATH_DETAIL_FORCEINLINE void
+record_headroom_0(std::false_type /*isWide*/, V v) noexcept
+{
+    using site = headroom_site<Site, V, Operation>;
+
+    auto magnitude = detail::headroom_magnitude(v);
+    if (SLOWMATH_DETAIL_UNLIKELY(magnitude >= site::bound().load(std::memory_order_relaxed)))
+    {
+        site::update_bound(magnitude);
+    }
+}
+template <typename Site, arithmetic_operation Operation, typename V>
+SLOWMATH_DETAIL_FORCEINLINE void
+record_headroom_0(std::true_type /*isWide*/, V v) noexcept
+{
+    using site = headroom_site<Site, V, Operation>;
+
+    auto bitsPlusOne = static_cast<unsigned char>(detail::required_bits(v) + 1);
+    if (SLOWMATH_DETAIL_UNLIKELY(bitsPlusOne > site::max_bits_plus_one().load(std::memory_order_relaxed)))
+    {
+        site::update(bitsPlusOne);
+    }
+}
+template <typename Site, arithmetic_operation Operation, typename V>
+SLOWMATH_DETAIL_FORCEINLINE void
+record_headroom(V v) noexcept
+{
+    detail::record_headroom_0<Site, Operation>(std::integral_constant<bool, (sizeof(V) > sizeof(std::uint64_t))>{ }, v);
+}
+
+    // The name of an operation in headroom profiles.
+constexpr char const*
+operation_name(arithmetic_operation operation) noexcept
+{
+    switch (operation)
+    {
+    case arithmetic_operation::absi:              return "absi";
+    case arithmetic_operation::negate:            return "negate";
+    case arithmetic_operation::add:               return "add";
+    case arithmetic_operation::subtract:          return "subtract";
+    case arithmetic_operation::multiply:          return "multiply";
+    case arithmetic_operation::multiply_add:      return "multiply_add";
+    case arithmetic_operation::multiply_subtract: return "multiply_subtract";
+    case arithmetic_operation::divide:            return "divide";
+    case arithmetic_operation::modulo:            return "modulo";
+    case arithmetic_operation::narrow:            return "narrow";
+    case arithmetic_operation::square:            return "square";
+    case arithmetic_operation::shift_left:        return "shift_left";
+    case arithmetic_operation::shift_right:       return "shift_right";
+    case arithmetic_operation::powi:              return "powi";
+    case arithmetic_operation::floori:            return "floori";
+    case arithmetic_operation::ceili:             return "ceili";
+    case arithmetic_operation::ratio_floori:      return "ratio_floori";
+    case arithmetic_operation::ratio_ceili:       return "ratio_ceili";
+    case arithmetic_operation::muldiv_floori:     return "muldiv_floori";
+    case arithmetic_operation::muldiv_ceili:      return "muldiv_ceili";
+    case arithmetic_operation::factorize_ceili:   return "factorize_ceili";
+    case arithmetic_operation::gcd:               return "gcd";
+    case arithmetic_operation::lcm:               return "lcm";
+    case arithmetic_operation::sum:               return "sum";
+    case arithmetic_operation::product:           return "product";
+    case arithmetic_operation::dot:               return "dot";
+    case arithmetic_operation::exclusive_scan:    return "exclusive_scan";
+    case arithmetic_operation::inclusive_scan:    return "inclusive_scan";
+    default:                                      return "unspecified";
+    }
+}
+
+
+inline void
+write_json_string(std::ostream& os, char const* str)
+{
+    os << '"';
+    if (str != nullptr)
+    {
+        for (; *str != '\0'; ++str)
+        {
+            if (*str == '"' || *str == '\\') os << '\\';
+            if (static_cast<unsigned char>(*str) >= 0x20) os << *str;
+        }
+    }
+    os << '"';
+}
+
+
+} // namespace detail
+
+} // namespace slowmath
+
+
+#endif // INCLUDED_SLOWMATH_DETAIL_TELEMETRY_HPP_
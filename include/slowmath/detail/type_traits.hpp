@@ -4,12 +4,18 @@
 
 
 #include <limits>
+#include <cstddef>      // for size_t
 #include <cstdint>      // for [u]int(8|16|32|64)_t
-#include <type_traits>  // for integral_constant<>, make_unsigned<>, is_signed<>, is_integral<>, is_same<>, common_type<>
+#include <type_traits>  // for integral_constant<>, make_signed<>, make_unsigned<>, is_signed<>, is_integral<>, is_same<>, common_type<>
 
 #include <gsl-lite/gsl-lite.hpp>  // for conjunction<>
 
 
+#if defined(__SIZEOF_INT128__) && !defined(__CUDA_ARCH__)
+# define SLOWMATH_DETAIL_HAVE_INT128 1
+#endif
+
+
 namespace slowmath
 {
 
@@ -27,9 +33,42 @@ template <typename V> using integral_value_type = typename integral_value_type_<
 
 template <typename... Vs> using common_integral_value_type = std::common_type_t<typename integral_value_type_<Vs>::type...>;
 
-template <typename V> struct is_nonbool_integral : std::is_integral<V> { };
+    // `R` if a result type was specified explicitly, otherwise the common value type of the arguments.
+template <typename R, typename... Vs> struct explicit_or_common_integral_value_type_ { using type = R; };
+template <typename... Vs> struct explicit_or_common_integral_value_type_<void, Vs...> { using type = common_integral_value_type<Vs...>; };
+template <typename R, typename... Vs> using explicit_or_common_integral_value_type = typename explicit_or_common_integral_value_type_<R, Vs...>::type;
+
+    // Like `std::type_identity_t<>`; used to exclude a function parameter from template argument deduction.
+template <typename T> struct type_identity_ { using type = T; };
+template <typename T> using type_identity_t = typename type_identity_<T>::type;
+
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+__extension__ typedef __int128 int128;           // `__extension__` suppresses pedantic warnings
+__extension__ typedef unsigned __int128 uint128;
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+
+    // Like `std::is_integral<>` and `std::is_signed<>` but also support the native 128-bit integer types (which the standard
+    // library may not know about in strict ISO mode).
+template <typename V> struct is_integral_ : std::is_integral<V> { };
+template <typename V> struct is_signed_ : std::is_signed<V> { };
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <> struct is_integral_<int128> : std::true_type { };
+template <> struct is_integral_<uint128> : std::true_type { };
+template <> struct is_signed_<int128> : std::true_type { };
+template <> struct is_signed_<uint128> : std::false_type { };
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <typename V> constexpr bool is_signed_v = is_signed_<V>::value;
+
+template <typename V> struct is_nonbool_integral : is_integral_<V> { };
 template <> struct is_nonbool_integral<bool> : std::false_type { };
 
+template <typename V> struct is_integral_constant : std::false_type { };
+template <typename V, V Value> struct is_integral_constant<std::integral_constant<V, Value>> : std::true_type { };
+
+    // Determines whether V is an `std::integral_constant<>` with a value that is a positive power of 2.
+template <typename V> struct is_power_of_two_constant : std::false_type { };
+template <typename V, V Value> struct is_power_of_two_constant<std::integral_constant<V, Value>> : std::integral_constant<bool, (Value > 0 && (Value & (Value - 1)) == 0)> { };
+
 template <typename V> struct is_value_type_nonbool_integral : is_nonbool_integral<V> { };
 template <typename V, V Value> struct is_value_type_nonbool_integral<std::integral_constant<V, Value>> : is_nonbool_integral<V> { };
 
@@ -37,27 +76,74 @@ template <typename... Vs> constexpr bool are_integral_arithmetic_types_v = gsl::
 
 template <typename... Vs> constexpr bool are_value_types_integral_arithmetic_types_v = gsl::conjunction<is_value_type_nonbool_integral<Vs>...>::value;
 
-template <bool Signed, typename... Vs> using have_same_signedness_0 = gsl::conjunction<std::integral_constant<bool, std::is_signed<integral_value_type<Vs>>::value == Signed>...>;
+template <bool Signed, typename... Vs> using have_same_signedness_0 = gsl::conjunction<std::integral_constant<bool, is_signed_v<integral_value_type<Vs>> == Signed>...>;
 template <typename... Vs> struct have_same_signedness;
-template <typename V0, typename... Vs> struct have_same_signedness<V0, Vs...> : have_same_signedness_0<std::is_signed<integral_value_type<V0>>::value, Vs...> { };
+template <typename V0, typename... Vs> struct have_same_signedness<V0, Vs...> : have_same_signedness_0<is_signed_v<integral_value_type<V0>>, Vs...> { };
 template <> struct have_same_signedness<> : std::true_type { };
 template <typename... Vs> constexpr bool have_same_signedness_v = have_same_signedness<Vs...>::value;
 
-template <typename V> struct wider_type_;
+    // Determines whether the common value type of arguments of identical signedness is the desired result type `R`, in which case
+    // the operation can be carried out in `R` directly.
+template <typename R, typename... Vs> struct is_common_result_type : std::integral_constant<bool, have_same_signedness_v<Vs...> && std::is_same<R, common_integral_value_type<Vs...>>::value> { };
+
+    // Portable double-word integer used as a wider type if the compiler has no native 128-bit integer type.
+template <typename V> struct double_word;
+template <typename W> struct is_double_word : std::false_type { };
+template <typename V> struct is_double_word<double_word<V>> : std::true_type { };
+
+template <std::size_t Size, bool Signed> struct wider_type_by_size_ { }; // no wider type
+template <> struct wider_type_by_size_<1, true> { using type = std::int32_t; };
+template <> struct wider_type_by_size_<2, true> { using type = std::int32_t; };
+template <> struct wider_type_by_size_<4, true> { using type = std::int64_t; };
+template <> struct wider_type_by_size_<1, false> { using type = std::uint32_t; };
+template <> struct wider_type_by_size_<2, false> { using type = std::uint32_t; };
+template <> struct wider_type_by_size_<4, false> { using type = std::uint64_t; };
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <> struct wider_type_by_size_<8, true> { using type = int128; };
+template <> struct wider_type_by_size_<8, false> { using type = uint128; };
+#else // !defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <> struct wider_type_by_size_<8, true> { using type = double_word<std::int64_t>; };
+template <> struct wider_type_by_size_<8, false> { using type = double_word<std::uint64_t>; };
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <typename V> struct wider_type_ : wider_type_by_size_<sizeof(V), is_signed_v<V>> { };
 template <typename V> using wider_type = typename wider_type_<V>::type;
-template <> struct wider_type_<std::int8_t> { using type = std::int32_t; };
-template <> struct wider_type_<std::int16_t> { using type = std::int32_t; };
-template <> struct wider_type_<std::int32_t> { using type = std::int64_t; };
-template <> struct wider_type_<std::uint8_t> { using type = std::uint32_t; };
-template <> struct wider_type_<std::uint16_t> { using type = std::uint32_t; };
-template <> struct wider_type_<std::uint32_t> { using type = std::uint64_t; };
-template <typename V> constexpr bool has_wider_type_v = sizeof(V) <= sizeof(std::uint32_t);
+template <typename V> constexpr bool has_wider_type_v = sizeof(V) <= sizeof(std::uint64_t);
 template <typename V> struct has_wider_type : std::integral_constant<bool, has_wider_type_v<V>> { };
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <typename V> constexpr bool has_native_wider_type_v = has_wider_type_v<V>;
+#else // !defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <typename V> constexpr bool has_native_wider_type_v = sizeof(V) <= sizeof(std::uint32_t);
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <typename V> struct has_native_wider_type : std::integral_constant<bool, has_native_wider_type_v<V>> { };
+
+    // The wider type of V if there is one, otherwise `double_word<V>`.
+template <typename V, bool HasWiderType = has_wider_type_v<V>> struct double_width_type_ : wider_type_<V> { };
+template <typename V> struct double_width_type_<V, false> { using type = double_word<V>; };
+template <typename V> using double_width_type = typename double_width_type_<V>::type;
+
+    // Like `std::make_signed<>` and `std::make_unsigned<>` but also support the native 128-bit integer types.
+template <typename V> struct make_signed_ : std::make_signed<V> { };
+template <typename V> struct make_unsigned_ : std::make_unsigned<V> { };
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <> struct make_signed_<int128> { using type = int128; };
+template <> struct make_signed_<uint128> { using type = int128; };
+template <> struct make_unsigned_<int128> { using type = uint128; };
+template <> struct make_unsigned_<uint128> { using type = uint128; };
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+template <typename V> using make_signed_t = typename make_signed_<V>::type;
+template <typename V> using make_unsigned_t = typename make_unsigned_<V>::type;
 
 template <typename EH, typename V> using result_t = typename EH::template result<V>;
 
 template <typename T> constexpr T min_v = std::numeric_limits<T>::min();
 template <typename T> constexpr T max_v = std::numeric_limits<T>::max();
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+    // This assumes a two's complement representation.
+template <> constexpr uint128 min_v<uint128> = 0;
+template <> constexpr uint128 max_v<uint128> = uint128(~uint128(0));
+template <> constexpr int128 max_v<int128> = int128(max_v<uint128> >> 1);
+template <> constexpr int128 min_v<int128> = -max_v<int128> - 1;
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
 
 
 } // namespace detail
@@ -0,0 +1,1077 @@
+
+#ifndef INCLUDED_SLOWMATH_PARALLEL_HPP_
+#define INCLUDED_SLOWMATH_PARALLEL_HPP_
+
+
+#include <cstddef>       // for size_t
+#include <algorithm>     // for none_of()
+#include <system_error>  // for errc
+#include <type_traits>   // for is_same<>, remove_const<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for span<>, gsl_Expects(), gsl_ExpectsAudit(), gsl_Assert(), gsl_HAVE_EXCEPTIONS, gsl_NODISCARD
+
+#include <slowmath/arithmetic.hpp>          // for arithmetic_result<>, arithmetic_operation, default_error_handler
+#include <slowmath/detail/type_traits.hpp>  // for are_integral_arithmetic_types_v<>, are_value_types_integral_arithmetic_types_v<>, have_same_signedness_v<>, common_integral_value_type<>, type_identity_t<>, result_t<>
+#include <slowmath/detail/errors.hpp>       // for failfast_error_handler, try_error_handler, checked_error_handler<>, saturate_error_handler, throw_overflow_error(), record_try_result(), checked_result<>()
+#include <slowmath/detail/batch.hpp>        // for transform_batch(), unary_batch<>, binary_batch<>, scalar_batch<>, *_wrapping_op
+#include <slowmath/detail/narrow.hpp>       // for narrow_batch()
+#include <slowmath/detail/parallel.hpp>     // for get_num_chunks(), chunk_range, parallel_batch(), parallel_sum(), parallel_product(), parallel_dot(), parallel_scan()
+
+
+namespace slowmath {
+
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Execution policy which lets the span overloads of the checked operations process the elements concurrently.
+    //ᅟ
+    // The elements are split into contiguous chunks of nearly equal size, each of which is processed by a separate thread with
+    // the sequential algorithm. The results of the chunks are combined in order, so the results and the reported errors do not
+    // depend on the number of threads: the `try_` overloads report the index of the first offending element. However, unlike
+    // for the sequential overloads, the elements of the destination span from that index on have unspecified values.
+    //ᅟ
+    // The threads are started for every operation. Using this header requires linking with the thread library of the platform,
+    // e.g. `Threads::Threads` in CMake.
+    //
+struct parallel_policy
+{
+    unsigned numThreads = 0;                          // number of threads to use, or 0 to use `std::thread::hardware_concurrency()`
+    std::size_t minChunkSize = std::size_t(1) << 16;  // minimal number of elements processed by a thread
+};
+
+    //
+    // Execution policy for concurrent processing with the default settings of `parallel_policy`.
+    //
+constexpr parallel_policy par{ };
+
+
+    //
+    // Computes |v| for every element v of src and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+absi_failfast(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::unary_batch<detail::absi_wrapping_op, V>{ src.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes |v| for every element v of src and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then have unspecified values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_absi(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::unary_batch<detail::absi_wrapping_op, V>{ src.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes |v| for every element v of src and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+absi_checked(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::unary_batch<detail::absi_wrapping_op, V>{ src.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::absi SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes -v for every element v of src and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+negate_failfast(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::unary_batch<detail::negate_wrapping_op, V>{ src.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes -v for every element v of src and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then have unspecified values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_negate(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::unary_batch<detail::negate_wrapping_op, V>{ src.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes -v for every element v of src and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+negate_checked(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(std::is_same<std::remove_const_t<V>, R>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::unary_batch<detail::negate_wrapping_op, V>{ src.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::negate SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a + b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename V>
+void
+add_failfast(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::add_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes a + b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then have unspecified values.
+    //
+template <typename A, typename B, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_add(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::add_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a + b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename V>
+void
+add_checked(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::add_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::add SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a - b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename V>
+void
+subtract_failfast(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::subtract_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes a - b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then have unspecified values.
+    //
+template <typename A, typename B, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_subtract(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::subtract_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a - b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename V>
+void
+subtract_checked(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::subtract_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::subtract SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a ∙ b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B, typename V>
+void
+multiply_failfast(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::multiply_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes a ∙ b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then have unspecified values.
+    //
+template <typename A, typename B, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_multiply(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::multiply_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b for the corresponding elements of a and b and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias a or b.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B, typename V>
+void
+multiply_checked(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>, V>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>, V>::value, "destination element type must be the common type of the argument element types");
+
+    gsl_Expects(a.size() == dst.size() && b.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::binary_batch<detail::multiply_wrapping_op, A, B>{ a.data() + range.begin, b.data() + range.begin }, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::multiply SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Converts the elements of src to type `R` and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that all elements are representable by `R`.
+    //
+template <typename V, typename R>
+void
+narrow_failfast(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, src.size()), src.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::narrow_batch(src.data() + range.begin, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == src.size());
+}
+
+    //
+    // Converts the elements of src to type `R` and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements converted. If an element is not representable
+    // by `R`, returns its index along with error code `std::errc::value_too_large`; the elements of dst from that index on then
+    // have unspecified values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_narrow(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, src.size()), src.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::narrow_batch(src.data() + range.begin, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == src.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Converts the elements of src to type `R` and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` if an element is not representable by `R`.
+    //
+template <typename V, typename R>
+void
+narrow_checked(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, src.size()), src.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::narrow_batch(src.data() + range.begin, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != src.size())) detail::throw_overflow_error(arithmetic_operation::narrow SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename V>
+gsl_NODISCARD detail::result_t<EH, std::remove_const_t<V>>
+sum(parallel_policy const& policy, gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::parallel_sum<EH>(detail::get_num_chunks(policy, v.size()), v.data(), v.size());
+}
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+sum_failfast(parallel_policy const& policy, gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::parallel_sum<detail::failfast_error_handler>(detail::get_num_chunks(policy, v.size()), v.data(), v.size());
+}
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD arithmetic_result<std::remove_const_t<V>>
+try_sum(parallel_policy const& policy, gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::record_try_result(detail::parallel_sum<detail::try_error_handler>(detail::get_num_chunks(policy, v.size()), v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+sum_checked(parallel_policy const& policy, gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::sum>(
+        detail::parallel_sum<detail::checked_error_handler<arithmetic_operation::sum>>(detail::get_num_chunks(policy, v.size()), v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes the sum of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+sum_saturating(parallel_policy const& policy, gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::parallel_sum<detail::saturate_error_handler>(detail::get_num_chunks(policy, v.size()), v.data(), v.size());
+}
+
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename V>
+gsl_NODISCARD detail::result_t<EH, std::remove_const_t<V>>
+product(parallel_policy const& policy, gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::parallel_product<EH>(detail::get_num_chunks(policy, v.size()), v.data(), v.size());
+}
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+product_failfast(parallel_policy const& policy, gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::parallel_product<detail::failfast_error_handler>(detail::get_num_chunks(policy, v.size()), v.data(), v.size());
+}
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD arithmetic_result<std::remove_const_t<V>>
+try_product(parallel_policy const& policy, gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::record_try_result(detail::parallel_product<detail::try_error_handler>(detail::get_num_chunks(policy, v.size()), v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Throws `overflow_error` upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+product_checked(parallel_policy const& policy, gsl::span<V> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::product>(
+        detail::parallel_product<detail::checked_error_handler<arithmetic_operation::product>>(detail::get_num_chunks(policy, v.size()), v.data(), v.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes the product of the elements of v.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename V>
+gsl_NODISCARD std::remove_const_t<V>
+product_saturating(parallel_policy const& policy, gsl::span<V> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>>, "span element type must be an integral type");
+
+    return detail::parallel_product<detail::saturate_error_handler>(detail::get_num_chunks(policy, v.size()), v.data(), v.size());
+}
+
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename A, typename B>
+gsl_NODISCARD detail::result_t<EH, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>
+dot(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::parallel_dot<EH, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(detail::get_num_chunks(policy, a.size()), a.data(), b.data(), a.size());
+}
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename A, typename B>
+gsl_NODISCARD detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>
+dot_failfast(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::parallel_dot<detail::failfast_error_handler, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(detail::get_num_chunks(policy, a.size()), a.data(), b.data(), a.size());
+}
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`. Returns error code `std::errc::value_too_large` upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD arithmetic_result<detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>
+try_dot(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::record_try_result(detail::parallel_dot<detail::try_error_handler, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(detail::get_num_chunks(policy, a.size()), a.data(), b.data(), a.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>
+dot_checked(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::checked_result<arithmetic_operation::dot>(
+        detail::parallel_dot<detail::checked_error_handler<arithmetic_operation::dot>, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(detail::get_num_chunks(policy, a.size()), a.data(), b.data(), a.size()) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes the sum of the products of the corresponding elements of a and b.
+    //ᅟ
+    // The result is computed exactly, so intermediate results may exceed the range of the result type. The overflow check is
+    // done once for the entire span. The elements are processed concurrently in chunks as specified by `policy`.
+    // Enforces preconditions with `gsl_Expects()`. Saturates to the smallest or largest representable value upon overflow.
+    //
+template <typename A, typename B>
+gsl_NODISCARD detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>
+dot_saturating(parallel_policy const& policy, gsl::span<A> a, gsl::span<B> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<A>, std::remove_const_t<B>>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<A>, std::remove_const_t<B>>, "argument types must have identical signedness");
+
+    gsl_Expects(a.size() == b.size());
+
+    return detail::parallel_dot<detail::saturate_error_handler, detail::common_integral_value_type<std::remove_const_t<A>, std::remove_const_t<B>>>(detail::get_num_chunks(policy, a.size()), a.data(), b.data(), a.size());
+}
+
+
+    //
+    // Computes the running sums init, init + src[0], …, init + src[0] + … + src[n - 2] and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src. The sum of all elements is not computed.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+exclusive_scan_failfast(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst, detail::type_identity_t<R> init = 0)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_scan<false>(detail::get_num_chunks(policy, dst.size()), src.data(), dst.data(), dst.size(), init);
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes the running sums init, init + src[0], …, init + src[0] + … + src[n - 2] and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src. The sum of all elements is not computed.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first element whose running sum is not representable along with error code `std::errc::value_too_large`;
+    // the elements of dst from that index on then have unspecified values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_exclusive_scan(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst, detail::type_identity_t<R> init = 0 SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_scan<false>(detail::get_num_chunks(policy, dst.size()), src.data(), dst.data(), dst.size(), init);
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the running sums init, init + src[0], …, init + src[0] + … + src[n - 2] and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src. The sum of all elements is not computed.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+exclusive_scan_checked(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst, detail::type_identity_t<R> init = 0 SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_scan<false>(detail::get_num_chunks(policy, dst.size()), src.data(), dst.data(), dst.size(), init);
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::exclusive_scan SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes the running sums src[0], src[0] + src[1], …, src[0] + … + src[n - 1] and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename V, typename R>
+void
+inclusive_scan_failfast(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_scan<true>(detail::get_num_chunks(policy, dst.size()), src.data(), dst.data(), dst.size(), R(0));
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes the running sums src[0], src[0] + src[1], …, src[0] + … + src[n - 1] and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first element whose running sum is not representable along with error code `std::errc::value_too_large`;
+    // the elements of dst from that index on then have unspecified values.
+    //
+template <typename V, typename R>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_inclusive_scan(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_scan<true>(detail::get_num_chunks(policy, dst.size()), src.data(), dst.data(), dst.size(), R(0));
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes the running sums src[0], src[0] + src[1], …, src[0] + … + src[n - 1] and stores them in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias src.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename V, typename R>
+void
+inclusive_scan_checked(parallel_policy const& policy, gsl::span<V> src, gsl::span<R> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<V>, R>, "span element types must be integral types");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<V>, R>, "argument types must have identical signedness");
+    static_assert(sizeof(std::remove_const_t<V>) <= sizeof(R), "destination element type must be at least as wide as the source element type");
+
+    gsl_Expects(src.size() == dst.size());
+
+    std::size_t n = detail::parallel_scan<true>(detail::get_num_chunks(policy, dst.size()), src.data(), dst.data(), dst.size(), R(0));
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::inclusive_scan SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes x ∙ 2ˢ for every element x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits) and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename X, typename S, typename V>
+void
+shift_left_failfast(parallel_policy const& policy, gsl::span<X> x, S s, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<S>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(std::is_same<std::remove_const_t<X>, V>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(s >= 0);
+    gsl_ExpectsAudit(std::none_of(x.begin(), x.end(), [](std::remove_const_t<X> v) { return v < 0; }));
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::scalar_batch<detail::shift_left_wrapping_op, X, S>{ x.data() + range.begin, s }, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes x ∙ 2ˢ for every element x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits) and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then have unspecified values.
+    //
+template <typename X, typename S, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_shift_left(parallel_policy const& policy, gsl::span<X> x, S s, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<S>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(std::is_same<std::remove_const_t<X>, V>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(s >= 0);
+    gsl_ExpectsAudit(std::none_of(x.begin(), x.end(), [](std::remove_const_t<X> v) { return v < 0; }));
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::scalar_batch<detail::shift_left_wrapping_op, X, S>{ x.data() + range.begin, s }, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes x ∙ 2ˢ for every element x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits) and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename X, typename S, typename V>
+void
+shift_left_checked(parallel_policy const& policy, gsl::span<X> x, S s, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<S>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(std::is_same<std::remove_const_t<X>, V>::value, "destination element type must match the argument element type");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(s >= 0);
+    gsl_ExpectsAudit(std::none_of(x.begin(), x.end(), [](std::remove_const_t<X> v) { return v < 0; }));
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::scalar_batch<detail::shift_left_wrapping_op, X, S>{ x.data() + range.begin, s }, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::shift_left SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every element x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename X, typename D, typename V>
+void
+ceili_failfast(parallel_policy const& policy, gsl::span<X> x, D d, gsl::span<V> dst)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<D>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<X>, D>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<X>, D>, V>::value, "destination element type must be the common type of the argument types");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(d > 0);
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::scalar_batch<detail::ceili_wrapping_op, X, D>{ x.data() + range.begin, d }, dst.data() + range.begin, range.end - range.begin);
+        });
+    gsl_Assert(n == dst.size());
+}
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every element x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Returns the number of elements computed. If an overflow occurs, returns the
+    // index of the first offending element along with error code `std::errc::value_too_large`; the elements of dst from that
+    // index on then have unspecified values.
+    //
+template <typename X, typename D, typename V>
+gsl_NODISCARD arithmetic_result<std::size_t>
+try_ceili(parallel_policy const& policy, gsl::span<X> x, D d, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<D>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<X>, D>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<X>, D>, V>::value, "destination element type must be the common type of the argument types");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(d > 0);
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::scalar_batch<detail::ceili_wrapping_op, X, D>{ x.data() + range.begin, d }, dst.data() + range.begin, range.end - range.begin);
+        });
+    auto result = arithmetic_result<std::size_t>{ n, n == dst.size() ? std::errc{ } : std::errc::value_too_large };
+    return detail::record_try_result(result SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every element x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, and stores the results in dst.
+    //ᅟ
+    // The elements are processed concurrently in chunks as specified by `policy`. dst may alias x.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow.
+    //
+template <typename X, typename D, typename V>
+void
+ceili_checked(parallel_policy const& policy, gsl::span<X> x, D d, gsl::span<V> dst SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<std::remove_const_t<X>, V>, "span element types must be integral types");
+    static_assert(detail::are_value_types_integral_arithmetic_types_v<D>, "argument must be an integral type or an std::integral_constant<> of an integral type");
+    static_assert(detail::have_same_signedness_v<std::remove_const_t<X>, D>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<std::remove_const_t<X>, D>, V>::value, "destination element type must be the common type of the argument types");
+
+    gsl_Expects(x.size() == dst.size());
+    gsl_Expects(d > 0);
+
+    std::size_t n = detail::parallel_batch(detail::get_num_chunks(policy, dst.size()), dst.size(),
+        [&](std::size_t /*i*/, detail::chunk_range range)
+        {
+            return detail::transform_batch(detail::scalar_batch<detail::ceili_wrapping_op, X, D>{ x.data() + range.begin, d }, dst.data() + range.begin, range.end - range.begin);
+        });
+    if (SLOWMATH_DETAIL_UNLIKELY(n != dst.size())) detail::throw_overflow_error(arithmetic_operation::ceili SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+} // namespace slowmath
+
+
+#endif // INCLUDED_SLOWMATH_PARALLEL_HPP_
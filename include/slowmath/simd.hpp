@@ -0,0 +1,679 @@
+
+#ifndef INCLUDED_SLOWMATH_SIMD_HPP_
+#define INCLUDED_SLOWMATH_SIMD_HPP_
+
+
+#include <type_traits>  // for is_same<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_HAVE_EXCEPTIONS, gsl_NODISCARD
+
+#include <slowmath/arithmetic.hpp>          // for arithmetic_operation, default_error_handler
+#include <slowmath/detail/simd.hpp>         // for SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD, transform_simd(), map_simd(), check_lanes(), simd_operand_value_type<>, all_lanes_nonnegative(), all_lanes_positive(), *_wrapping_op, *_saturating_op
+#include <slowmath/detail/type_traits.hpp>  // for are_integral_arithmetic_types_v<>, have_same_signedness_v<>, common_integral_value_type<>, result_t<>
+#include <slowmath/detail/errors.hpp>       // for failfast_error_handler, checked_error_handler<>, record_try_result(), checked_result<>()
+
+#if SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD
+
+
+namespace slowmath {
+
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // The result of a `try_` operation on vectors: the lane-wise results along with the mask of the lanes for which an overflow
+    // occurs.
+    //
+template <typename S>
+struct simd_arithmetic_result
+{
+    S value;
+    typename S::mask_type overflow;
+};
+
+
+    //
+    // Computes |v| for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+absi(std::experimental::simd<T, Abi> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::absi_wrapping_op>(v));
+}
+
+    //
+    // Computes |v| for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+absi_failfast(std::experimental::simd<T, Abi> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::absi_wrapping_op>(v));
+}
+
+    //
+    // Computes |v| for every lane v of v.
+    //ᅟ
+    // Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_absi(std::experimental::simd<T, Abi> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::absi_wrapping_op>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes |v| for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+absi_checked(std::experimental::simd<T, Abi> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::absi>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::absi>>(detail::transform_simd<detail::absi_wrapping_op>(v)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes -v for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+negate(std::experimental::simd<T, Abi> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::negate_wrapping_op>(v));
+}
+
+    //
+    // Computes -v for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+negate_failfast(std::experimental::simd<T, Abi> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::negate_wrapping_op>(v));
+}
+
+    //
+    // Computes -v for every lane v of v.
+    //ᅟ
+    // Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_negate(std::experimental::simd<T, Abi> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::negate_wrapping_op>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes -v for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+negate_checked(std::experimental::simd<T, Abi> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::negate>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::negate>>(detail::transform_simd<detail::negate_wrapping_op>(v)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes a + b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+add(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::add_wrapping_op>(a, b));
+}
+
+    //
+    // Computes a + b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+add_failfast(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::add_wrapping_op>(a, b));
+}
+
+    //
+    // Computes a + b for the corresponding lanes of a and b.
+    //ᅟ
+    // Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_add(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::add_wrapping_op>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a + b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+add_checked(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::add>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::add>>(detail::transform_simd<detail::add_wrapping_op>(a, b)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes a + b for the corresponding lanes of a and b.
+    //ᅟ
+    // Saturates every lane which overflows to the smallest or largest representable value.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+add_saturating(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::map_simd<detail::add_saturating_op>(a, b);
+}
+
+
+    //
+    // Computes a - b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+subtract(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::subtract_wrapping_op>(a, b));
+}
+
+    //
+    // Computes a - b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+subtract_failfast(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::subtract_wrapping_op>(a, b));
+}
+
+    //
+    // Computes a - b for the corresponding lanes of a and b.
+    //ᅟ
+    // Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_subtract(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::subtract_wrapping_op>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a - b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+subtract_checked(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::subtract>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::subtract>>(detail::transform_simd<detail::subtract_wrapping_op>(a, b)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes a - b for the corresponding lanes of a and b.
+    //ᅟ
+    // Saturates every lane which overflows to the smallest or largest representable value.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+subtract_saturating(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::map_simd<detail::subtract_saturating_op>(a, b);
+}
+
+
+    //
+    // Computes a ∙ b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+multiply(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::multiply_wrapping_op>(a, b));
+}
+
+    //
+    // Computes a ∙ b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+multiply_failfast(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::multiply_wrapping_op>(a, b));
+}
+
+    //
+    // Computes a ∙ b for the corresponding lanes of a and b.
+    //ᅟ
+    // Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_multiply(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::multiply_wrapping_op>(a, b) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes a ∙ b for the corresponding lanes of a and b.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+multiply_checked(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::multiply>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::multiply>>(detail::transform_simd<detail::multiply_wrapping_op>(a, b)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes a ∙ b for the corresponding lanes of a and b.
+    //ᅟ
+    // Saturates every lane which overflows to the smallest or largest representable value.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+multiply_saturating(std::experimental::simd<T, Abi> a, std::experimental::simd<T, Abi> b)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::map_simd<detail::multiply_saturating_op>(a, b);
+}
+
+
+    //
+    // Computes v² for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+square(std::experimental::simd<T, Abi> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::square_wrapping_op>(v));
+}
+
+    //
+    // Computes v² for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+square_failfast(std::experimental::simd<T, Abi> v)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::square_wrapping_op>(v));
+}
+
+    //
+    // Computes v² for every lane v of v.
+    //ᅟ
+    // Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_square(std::experimental::simd<T, Abi> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::square_wrapping_op>(v) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes v² for every lane v of v.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+square_checked(std::experimental::simd<T, Abi> v SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+
+    return detail::checked_result<arithmetic_operation::square>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::square>>(detail::transform_simd<detail::square_wrapping_op>(v)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+    //
+    // Computes x ∙ 2ˢ for every lane x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits), where s is either a scalar or the
+    // corresponding lane of a vector.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi, typename S>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+shift_left(std::experimental::simd<T, Abi> x, S s)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::are_integral_arithmetic_types_v<detail::simd_operand_value_type<S, T, Abi>>, "shift count must be an integral type, an std::integral_constant<> of an integral type, or a vector of the argument type");
+
+    gsl_Expects(detail::all_lanes_nonnegative(x) && detail::all_lanes_nonnegative(s));
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::shift_left_wrapping_op>(x, s));
+}
+
+    //
+    // Computes x ∙ 2ˢ for every lane x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits), where s is either a scalar or the
+    // corresponding lane of a vector.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi, typename S>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+shift_left_failfast(std::experimental::simd<T, Abi> x, S s)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::are_integral_arithmetic_types_v<detail::simd_operand_value_type<S, T, Abi>>, "shift count must be an integral type, an std::integral_constant<> of an integral type, or a vector of the argument type");
+
+    gsl_Expects(detail::all_lanes_nonnegative(x) && detail::all_lanes_nonnegative(s));
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::shift_left_wrapping_op>(x, s));
+}
+
+    //
+    // Computes x ∙ 2ˢ for every lane x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits), where s is either a scalar or the
+    // corresponding lane of a vector.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi, typename S>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_shift_left(std::experimental::simd<T, Abi> x, S s SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::are_integral_arithmetic_types_v<detail::simd_operand_value_type<S, T, Abi>>, "shift count must be an integral type, an std::integral_constant<> of an integral type, or a vector of the argument type");
+
+    gsl_Expects(detail::all_lanes_nonnegative(x) && detail::all_lanes_nonnegative(s));
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::shift_left_wrapping_op>(x, s) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes x ∙ 2ˢ for every lane x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits), where s is either a scalar or the
+    // corresponding lane of a vector.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi, typename S>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+shift_left_checked(std::experimental::simd<T, Abi> x, S s SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::are_integral_arithmetic_types_v<detail::simd_operand_value_type<S, T, Abi>>, "shift count must be an integral type, an std::integral_constant<> of an integral type, or a vector of the argument type");
+
+    gsl_Expects(detail::all_lanes_nonnegative(x) && detail::all_lanes_nonnegative(s));
+
+    return detail::checked_result<arithmetic_operation::shift_left>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::shift_left>>(detail::transform_simd<detail::shift_left_wrapping_op>(x, s)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes x ∙ 2ˢ for every lane x ∊ ℕ₀ of x and s ∊ ℕ₀ (i.e. left-shifts x by s bits), where s is either a scalar or the
+    // corresponding lane of a vector.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Saturates every lane which overflows to the largest representable value.
+    //
+template <typename T, typename Abi, typename S>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+shift_left_saturating(std::experimental::simd<T, Abi> x, S s)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::are_integral_arithmetic_types_v<detail::simd_operand_value_type<S, T, Abi>>, "shift count must be an integral type, an std::integral_constant<> of an integral type, or a vector of the argument type");
+
+    gsl_Expects(detail::all_lanes_nonnegative(x) && detail::all_lanes_nonnegative(s));
+
+    return detail::map_simd<detail::shift_left_saturating_op>(x, s);
+}
+
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every lane x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, where d is either a scalar or the corresponding lane
+    // of a vector.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Enforces preconditions with `gsl_Expects()`.
+    // Handles overflow with the error handler `EH`, which defaults to `default_error_handler`.
+    //
+template <typename EH = default_error_handler, typename T, typename Abi, typename D>
+gsl_NODISCARD detail::result_t<EH, std::experimental::simd<T, Abi>>
+ceili(std::experimental::simd<T, Abi> x, D d)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::have_same_signedness_v<T, detail::simd_operand_value_type<D, T, Abi>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<T, detail::simd_operand_value_type<D, T, Abi>>, T>::value, "divisor type must not be wider than the vector element type");
+
+    gsl_Expects(detail::all_lanes_positive(d));
+
+    return detail::check_lanes<EH>(detail::transform_simd<detail::ceili_wrapping_op>(x, d));
+}
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every lane x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, where d is either a scalar or the corresponding lane
+    // of a vector.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Enforces preconditions with `gsl_Expects()`. Uses `gsl_Assert()` to check that no overflow occurs.
+    //
+template <typename T, typename Abi, typename D>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+ceili_failfast(std::experimental::simd<T, Abi> x, D d)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::have_same_signedness_v<T, detail::simd_operand_value_type<D, T, Abi>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<T, detail::simd_operand_value_type<D, T, Abi>>, T>::value, "divisor type must not be wider than the vector element type");
+
+    gsl_Expects(detail::all_lanes_positive(d));
+
+    return detail::check_lanes<detail::failfast_error_handler>(detail::transform_simd<detail::ceili_wrapping_op>(x, d));
+}
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every lane x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, where d is either a scalar or the corresponding lane
+    // of a vector.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Returns the results along with the mask of the lanes for which an overflow occurs; the results of these lanes are
+    // computed modulo 2ᴺ.
+    //
+template <typename T, typename Abi, typename D>
+gsl_NODISCARD simd_arithmetic_result<std::experimental::simd<T, Abi>>
+try_ceili(std::experimental::simd<T, Abi> x, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::have_same_signedness_v<T, detail::simd_operand_value_type<D, T, Abi>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<T, detail::simd_operand_value_type<D, T, Abi>>, T>::value, "divisor type must not be wider than the vector element type");
+
+    gsl_Expects(detail::all_lanes_positive(d));
+
+    auto r = detail::record_try_result(detail::transform_simd<detail::ceili_wrapping_op>(x, d) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+    return { r.value, r.overflow };
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every lane x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, where d is either a scalar or the corresponding lane
+    // of a vector.
+    //ᅟ
+    // The overflow check is done once for all lanes.
+    // Enforces preconditions with `gsl_Expects()`. Throws `overflow_error` upon overflow in any lane.
+    //
+template <typename T, typename Abi, typename D>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+ceili_checked(std::experimental::simd<T, Abi> x, D d SLOWMATH_DETAIL_SOURCE_LOCATION_PARAMETER)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::have_same_signedness_v<T, detail::simd_operand_value_type<D, T, Abi>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<T, detail::simd_operand_value_type<D, T, Abi>>, T>::value, "divisor type must not be wider than the vector element type");
+
+    gsl_Expects(detail::all_lanes_positive(d));
+
+    return detail::checked_result<arithmetic_operation::ceili>(
+        detail::check_lanes<detail::checked_error_handler<arithmetic_operation::ceili>>(detail::transform_simd<detail::ceili_wrapping_op>(x, d)) SLOWMATH_DETAIL_SOURCE_LOCATION_ARGUMENT);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+    //
+    // Computes ⌈x ÷ d⌉ ∙ d for every lane x ∊ ℤ of x and d ∊ ℕ, d ≠ 0, where d is either a scalar or the corresponding lane
+    // of a vector.
+    //ᅟ
+    // Enforces preconditions with `gsl_Expects()`. Saturates every lane which overflows to the largest representable value.
+    //
+template <typename T, typename Abi, typename D>
+gsl_NODISCARD std::experimental::simd<T, Abi>
+ceili_saturating(std::experimental::simd<T, Abi> x, D d)
+{
+    static_assert(detail::are_integral_arithmetic_types_v<T>, "vector element type must be an integral type");
+    static_assert(detail::have_same_signedness_v<T, detail::simd_operand_value_type<D, T, Abi>>, "argument types must have identical signedness");
+    static_assert(std::is_same<detail::common_integral_value_type<T, detail::simd_operand_value_type<D, T, Abi>>, T>::value, "divisor type must not be wider than the vector element type");
+
+    gsl_Expects(detail::all_lanes_positive(d));
+
+    return detail::map_simd<detail::ceili_saturating_op>(x, d);
+}
+
+
+} // namespace slowmath
+
+
+#endif // SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD
+
+
+#endif // INCLUDED_SLOWMATH_SIMD_HPP_
@@ -0,0 +1,371 @@
+
+#ifndef INCLUDED_SLOWMATH_TELEMETRY_HPP_
+#define INCLUDED_SLOWMATH_TELEMETRY_HPP_
+
+
+#include <atomic>
+#include <vector>
+#include <cstdint>       // for uint64_t
+#include <cstring>       // for strcmp()
+#include <fstream>
+#include <ostream>
+#include <algorithm>     // for sort(), find_if()
+#include <system_error>  // for errc
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_NODISCARD, gsl_HAVE_EXCEPTIONS
+
+#include <slowmath/detail/errors.hpp>     // for SLOWMATH_DETAIL_FORCEINLINE, arithmetic_operation
+#include <slowmath/detail/telemetry.hpp>  // for call_site_location<>, record_overflow(), telemetry_tables(), record_headroom(), headroom_sites(), operation_name(), write_json_string(), throw_telemetry_file_error()
+
+
+namespace slowmath {
+
+
+    //
+    // Declares a type `NAME` which identifies a call site for `telemetry_error_handler<>` and `headroom_error_handler<>`.
+    //
+#define SLOWMATH_CALL_SITE(NAME) \
+    struct NAME \
+    { \
+        static constexpr char const* name(void) noexcept { return #NAME; } \
+        static constexpr char const* file(void) noexcept { return __FILE__; } \
+        static constexpr unsigned line(void) noexcept { return __LINE__; } \
+    }
+
+    //
+    // Declares a type `NAME` which identifies a call site for `headroom_error_handler<>`. Equivalent to `SLOWMATH_CALL_SITE()`.
+    //
+#define SLOWMATH_HEADROOM_SITE(NAME)  SLOWMATH_CALL_SITE(NAME)
+
+    //
+    // Error handler which counts the overflow events reported by the error handler `EH`, and then handles them with `EH`.
+    //ᅟ
+    // Overflow events are counted per call site in lock-free thread-local tables. Successful operations are not affected by the
+    // instrumentation; only the error path is extended by a call to a function which is never inlined. The call site is
+    // identified by the return address of the recording function, which is an address in the function into which the operation
+    // was inlined (use e.g. `addr2line -Cfi` to map it to a source location), and by the source location of `Site`, a type
+    // declared with `SLOWMATH_CALL_SITE()`. If `Site` is `void`, no source location is recorded. Use `get_overflow_telemetry()`
+    // to obtain the counts.
+    //ᅟ
+    // Only error handlers whose `check()` can fail, such as `try_error_handler`, `throw_error_handler`, and
+    // `trap_error_handler`, report overflow events. The operation is compiled with a conditional branch to the error path,
+    // whereas `try_error_handler` alone usually selects the error code without branching. To instrument the `try_*()` and
+    // `*_checked()` operations without changing the code generated for the operation itself, define `SLOWMATH_OVERFLOW_TELEMETRY`
+    // as 1 instead; the events are then recorded with the source location of the call.
+    //
+template <typename EH, typename Site = void>
+struct telemetry_error_handler
+{
+    template <typename T> using result = typename EH::template result<T>;
+
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE result<T>
+    make_result(T value) noexcept
+    {
+        return EH::make_result(value);
+    }
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE decltype(EH::check(true))
+    check(bool condition)
+    {
+        return EH::check(condition);
+    }
+    static SLOWMATH_DETAIL_FORCEINLINE auto
+    make_error(std::errc ec)
+    {
+        detail::record_overflow(detail::call_site_location<Site>::file(), detail::call_site_location<Site>::line());
+        return EH::make_error(ec);
+    }
+    static SLOWMATH_DETAIL_FORCEINLINE auto
+    make_overflow_error(bool negative)
+    {
+        detail::record_overflow(detail::call_site_location<Site>::file(), detail::call_site_location<Site>::line());
+        return EH::make_overflow_error(negative);
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE auto
+    get_value(T const& r) noexcept
+    {
+        return EH::get_value(r);
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE auto
+    is_error(T const& r) noexcept
+    {
+        return EH::is_error(r);
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE auto
+    passthrough_error(T const& r)
+    {
+        return EH::passthrough_error(r);
+    }
+};
+
+
+    //
+    // The number of overflow events recorded for a call site.
+    //
+struct overflow_telemetry_record
+{
+    void const* caller;  // return address of the recording function, see `telemetry_error_handler<>`
+    char const* file;    // source location of the call, or `nullptr` if not known
+    unsigned line;
+    std::uint64_t count;
+};
+
+    //
+    // A snapshot of the overflow events recorded in all threads.
+    //
+struct overflow_telemetry
+{
+    std::vector<overflow_telemetry_record> records;  // ordered by descending count
+    std::uint64_t dropped = 0;                       // number of events not attributed to a call site because a table was full
+};
+
+
+    //
+    // Aggregates the overflow events recorded by `telemetry_error_handler<>`, or by the `try_*()` and `*_checked()` operations if
+    // `SLOWMATH_OVERFLOW_TELEMETRY` is defined as 1, in all threads.
+    //ᅟ
+    // The snapshot can be taken while other threads are recording events; events recorded concurrently may or may not be included.
+    //
+gsl_NODISCARD inline overflow_telemetry
+get_overflow_telemetry()
+{
+    auto result = overflow_telemetry{ };
+    for (auto table = detail::telemetry_tables().load(std::memory_order_acquire); table != nullptr; table = table->next)
+    {
+        for (auto& slot : table->slots)
+        {
+            if (!slot.used.load(std::memory_order_acquire)) continue;
+            auto count = slot.count.load(std::memory_order_relaxed);
+            auto it = std::find_if(result.records.begin(), result.records.end(),
+                [&slot](overflow_telemetry_record const& r)
+                {
+                    return r.caller == slot.caller && r.file == slot.file && r.line == slot.line;
+                });
+            if (it != result.records.end()) it->count += count;
+            else result.records.push_back({ slot.caller, slot.file, slot.line, count });
+        }
+        result.dropped += table->dropped.load(std::memory_order_relaxed);
+    }
+    std::sort(result.records.begin(), result.records.end(),
+        [](overflow_telemetry_record const& lhs, overflow_telemetry_record const& rhs)
+        {
+            return lhs.count > rhs.count;
+        });
+    return result;
+}
+
+
+enum class telemetry_format
+{
+    text,
+    json
+};
+
+    //
+    // Writes the given overflow telemetry snapshot to a stream, either as text with one line per call site or as a JSON object.
+    //
+inline void
+write_overflow_telemetry(std::ostream& os, overflow_telemetry const& telemetry, telemetry_format format = telemetry_format::text)
+{
+    if (format == telemetry_format::json)
+    {
+        os << "{\n  \"records\": [";
+        bool first = true;
+        for (auto const& r : telemetry.records)
+        {
+            os << (first ? "\n" : ",\n") << "    { \"caller\": \"" << r.caller << "\", \"file\": ";
+            detail::write_json_string(os, r.file);
+            os << ", \"line\": " << r.line << ", \"count\": " << r.count << " }";
+            first = false;
+        }
+        os << (first ? "],\n" : "\n  ],\n") << "  \"dropped\": " << telemetry.dropped << "\n}\n";
+    }
+    else
+    {
+        for (auto const& r : telemetry.records)
+        {
+            os << r.count << " overflow(s) at " << r.caller << " (called at " << (r.file != nullptr ? r.file : "?") << ':' << r.line << ")\n";
+        }
+        if (telemetry.dropped != 0)
+        {
+            os << telemetry.dropped << " overflow(s) at unrecorded call sites\n";
+        }
+    }
+}
+
+
+    //
+    // Error handler which records the number of bits required to represent the results of the operation `Operation` carried out
+    // at the call site `Site`, and then handles the results and errors with the error handler `EH`.
+    //ᅟ
+    // `Site` is a type declared with `SLOWMATH_CALL_SITE()` or `SLOWMATH_HEADROOM_SITE()`. For every result type, the largest
+    // number of bits required to represent a result (including the sign bit for signed types) is recorded; composite operations
+    // such as `powi()` also record their intermediate results. Use `get_headroom_profile()` to obtain the records.
+    //ᅟ
+    // A result is compared with a per-site bound loaded with a relaxed atomic operation; the records are updated in a function
+    // which is never inlined only if the bound is reached, which happens at most once per bit of the result type.
+    //
+template <typename EH, typename Site, arithmetic_operation Operation = arithmetic_operation::unspecified>
+struct headroom_error_handler
+{
+    template <typename T> using result = typename EH::template result<T>;
+
+    template <typename T>
+    static SLOWMATH_DETAIL_FORCEINLINE result<T>
+    make_result(T value) noexcept
+    {
+        detail::record_headroom<Site, Operation>(value);
+        return EH::make_result(value);
+    }
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE decltype(EH::check(true))
+    check(bool condition)
+    {
+        return EH::check(condition);
+    }
+    static inline auto
+    make_error(std::errc ec)
+    {
+        return EH::make_error(ec);
+    }
+    static inline auto
+    make_overflow_error(bool negative)
+    {
+        return EH::make_overflow_error(negative);
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE auto
+    get_value(T const& r) noexcept
+    {
+        return EH::get_value(r);
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE auto
+    is_error(T const& r) noexcept
+    {
+        return EH::is_error(r);
+    }
+    template <typename T>
+    static constexpr SLOWMATH_DETAIL_FORCEINLINE auto
+    passthrough_error(T const& r)
+    {
+        return EH::passthrough_error(r);
+    }
+};
+
+    //
+    // The largest number of bits required to represent a result of type `int<typeBits>_t` or `uint<typeBits>_t` of an operation
+    // at a call site. Except for `add_to()`, `subtract_to()`, `multiply_to()`, and `narrow()`, the result type is the common type
+    // of the operands.
+    //
+struct headroom_record
+{
+    char const* site;
+    char const* file;
+    unsigned line;
+    arithmetic_operation operation;  // `arithmetic_operation::unspecified` if not given to `headroom_error_handler<>`
+    bool isSigned;
+    unsigned typeBits;
+    unsigned maxBits;
+};
+
+    //
+    // Returns the headroom records of all call sites profiled with `headroom_error_handler<>`, ordered by file and line.
+    //
+gsl_NODISCARD inline std::vector<headroom_record>
+get_headroom_profile()
+{
+    auto result = std::vector<headroom_record>{ };
+    for (auto site = detail::headroom_sites().load(std::memory_order_acquire); site != nullptr; site = site->next)
+    {
+        result.push_back({ site->name, site->file, site->line, site->operation, site->isSigned, site->typeBits,
+            unsigned(site->maxBitsPlusOne->load(std::memory_order_relaxed)) - 1 });
+    }
+    std::sort(result.begin(), result.end(),
+        [](headroom_record const& lhs, headroom_record const& rhs)
+        {
+            int cmp = std::strcmp(lhs.file, rhs.file);
+            return cmp != 0 ? cmp < 0
+                : lhs.line != rhs.line ? lhs.line < rhs.line
+                : lhs.operation != rhs.operation ? lhs.operation < rhs.operation
+                : lhs.typeBits != rhs.typeBits ? lhs.typeBits < rhs.typeBits
+                : lhs.isSigned < rhs.isSigned;
+        });
+    return result;
+}
+
+    //
+    // Writes the given headroom profile to a stream, either as text with one line per call site, operation, and result type or as
+    // a JSON object.
+    //
+inline void
+write_headroom_profile(std::ostream& os, std::vector<headroom_record> const& profile, telemetry_format format = telemetry_format::text)
+{
+    if (format == telemetry_format::json)
+    {
+        os << "{\n  \"records\": [";
+        bool first = true;
+        for (auto const& r : profile)
+        {
+            os << (first ? "\n" : ",\n") << "    { \"site\": ";
+            detail::write_json_string(os, r.site);
+            os << ", \"file\": ";
+            detail::write_json_string(os, r.file);
+            os << ", \"line\": " << r.line << ", \"operation\": \"" << detail::operation_name(r.operation) << "\""
+               << ", \"type\": \"" << (r.isSigned ? "int" : "uint") << r.typeBits
+               << "\", \"max_bits\": " << r.maxBits << " }";
+            first = false;
+        }
+        os << (first ? "]\n" : "\n  ]\n") << "}\n";
+    }
+    else
+    {
+        for (auto const& r : profile)
+        {
+            os << r.site << " (" << r.file << ':' << r.line << "): ";
+            if (r.operation != arithmetic_operation::unspecified) os << detail::operation_name(r.operation) << "(), ";
+            os << (r.isSigned ? "int" : "uint") << r.typeBits
+               << " results never used more than " << r.maxBits << " bits\n";
+        }
+    }
+}
+
+#if gsl_HAVE_EXCEPTIONS
+    //
+    // Writes the given overflow telemetry snapshot to the file at the given path.
+    //ᅟ
+    // Throws `std::system_error` with error code `std::errc::io_error` if the file cannot be written.
+    //
+inline void
+write_overflow_telemetry(char const* path, overflow_telemetry const& telemetry, telemetry_format format = telemetry_format::text)
+{
+    std::ofstream file(path);
+    if (!file) detail::throw_telemetry_file_error(path);
+    slowmath::write_overflow_telemetry(file, telemetry, format);
+    file.flush();
+    if (!file) detail::throw_telemetry_file_error(path);
+}
+
+    //
+    // Writes the given headroom profile to the file at the given path.
+    //ᅟ
+    // Throws `std::system_error` with error code `std::errc::io_error` if the file cannot be written.
+    //
+inline void
+write_headroom_profile(char const* path, std::vector<headroom_record> const& profile, telemetry_format format = telemetry_format::text)
+{
+    std::ofstream file(path);
+    if (!file) detail::throw_telemetry_file_error(path);
+    slowmath::write_headroom_profile(file, profile, format);
+    file.flush();
+    if (!file) detail::throw_telemetry_file_error(path);
+}
+#endif // gsl_HAVE_EXCEPTIONS
+
+
+} // namespace slowmath
+
+
+#endif // INCLUDED_SLOWMATH_TELEMETRY_HPP_
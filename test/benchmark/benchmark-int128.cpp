@@ -0,0 +1,164 @@
+
+#include <array>
+#include <random>
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <slowmath/arithmetic.hpp>
+
+
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+
+namespace {
+
+
+using slowmath::detail::int128;
+using slowmath::detail::uint128;
+
+constexpr std::size_t numOperands = 1024;
+
+template <typename T>
+using operands = std::array<T, numOperands>;
+
+    // Generates operands with the given number of significant bits.
+template <typename T>
+operands<T>
+make_operands(std::mt19937_64& rng, int numBits, bool withSign = false)
+{
+    auto result = operands<T>{ };
+    for (auto& x : result)
+    {
+        uint128 u = (uint128(rng()) << 64) | rng();
+        u >>= 128 - numBits;
+        if (u == 0) u = 1;
+        x = withSign && (rng() & 1) != 0 ? T(-T(u)) : T(u);
+    }
+    return result;
+}
+
+
+    // Hand-rolled alternatives.
+
+int128
+add_sign_check(int128 a, int128 b)
+{
+    auto result = int128(uint128(a) + uint128(b));
+    if (((a ^ result) & (b ^ result)) < 0) throw slowmath::overflow_error{ };
+    return result;
+}
+
+uint128
+add_carry_check(uint128 a, uint128 b)
+{
+    uint128 result = a + b;
+    if (result < a) throw slowmath::overflow_error{ };
+    return result;
+}
+
+uint128
+multiply_division_check(uint128 a, uint128 b)
+{
+    if (b != 0 && a > slowmath::detail::max_v<uint128> / b) throw slowmath::overflow_error{ };
+    return a * b;
+}
+
+int128
+multiply_builtin(int128 a, int128 b)
+{
+    int128 result;
+    if (__builtin_mul_overflow(a, b, &result)) throw slowmath::overflow_error{ };
+    return result;
+}
+
+uint128
+powi_division_check(uint128 b, int e)
+{
+    uint128 result = 1;
+    for (int i = 0; i != e; ++i)
+    {
+        result = multiply_division_check(result, b);
+    }
+    return result;
+}
+
+uint128
+gcd_euclid(uint128 a, uint128 b)
+{
+    while (b != 0)
+    {
+        uint128 t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+int
+log_floori_division_bound(uint128 x, uint128 b)
+{
+    uint128 m = slowmath::detail::max_v<uint128> / b;
+    int e = 0;
+    for (uint128 x0 = 1; x0 <= m && x0 * b <= x; x0 *= b)
+    {
+        ++e;
+    }
+    return e;
+}
+
+int
+log_floori_bit_scan(uint128 x)
+{
+    auto hi = std::uint64_t(x >> 64);
+    return hi != 0 ? 127 - __builtin_clzll(hi) : 63 - __builtin_clzll(std::uint64_t(x));
+}
+
+
+} // anonymous namespace
+
+
+TEST_CASE("128-bit operations", "[!benchmark][int128]")
+{
+    auto rng = std::mt19937_64(42);
+
+        // The operands are chosen such that no operation overflows.
+    auto ia = make_operands<int128>(rng, 126, true);
+    auto ib = make_operands<int128>(rng, 126, true);
+    auto ua = make_operands<uint128>(rng, 127);
+    auto ub = make_operands<uint128>(rng, 127);
+    auto ma = make_operands<int128>(rng, 63, true);
+    auto mb = make_operands<int128>(rng, 63, true);
+    auto umb = make_operands<uint128>(rng, 63);
+    auto pb = make_operands<uint128>(rng, 31);
+    auto lb = make_operands<uint128>(rng, 8);
+    auto pe = std::array<int, numOperands>{ };
+    for (auto& e : pe)
+    {
+        e = int(rng() % 4);
+    }
+
+    BENCHMARK("add_checked<int128>") { int128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= slowmath::add_checked(ia[i], ib[i]); return s; };
+    BENCHMARK("add, hand-rolled sign check") { int128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= add_sign_check(ia[i], ib[i]); return s; };
+    BENCHMARK("add_checked<uint128>") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= slowmath::add_checked(ua[i], ub[i]); return s; };
+    BENCHMARK("add, hand-rolled carry check") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= add_carry_check(ua[i], ub[i]); return s; };
+
+    BENCHMARK("multiply_checked<int128>") { int128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= slowmath::multiply_checked(ma[i], mb[i]); return s; };
+    BENCHMARK("multiply, __builtin_mul_overflow()") { int128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= multiply_builtin(ma[i], mb[i]); return s; };
+    BENCHMARK("multiply_checked<uint128>") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= slowmath::multiply_checked(umb[i], ua[i] >> 64); return s; };
+    BENCHMARK("multiply, division check") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= multiply_division_check(umb[i], ua[i] >> 64); return s; };
+
+    BENCHMARK("powi_checked<uint128>") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= slowmath::powi_checked(pb[i], pe[i]); return s; };
+    BENCHMARK("powi, division check") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= powi_division_check(pb[i], pe[i]); return s; };
+
+    BENCHMARK("gcd_checked<uint128>") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= slowmath::gcd_checked(ua[i], ub[i]); return s; };
+    BENCHMARK("gcd, Euclid") { uint128 s = 0; for (std::size_t i = 0; i != numOperands; ++i) s ^= gcd_euclid(ua[i], ub[i]); return s; };
+
+    BENCHMARK("log_floori<uint128>") { int s = 0; for (std::size_t i = 0; i != numOperands; ++i) s += slowmath::log_floori<int>(ua[i], lb[i] + 1); return s; };
+    BENCHMARK("log_floori, division bound") { int s = 0; for (std::size_t i = 0; i != numOperands; ++i) s += log_floori_division_bound(ua[i], lb[i] + 1); return s; };
+    BENCHMARK("log_floori<uint128>, b = 2") { int s = 0; for (std::size_t i = 0; i != numOperands; ++i) s += slowmath::log_floori<int>(ua[i], uint128(2)); return s; };
+    BENCHMARK("log_floori, bit scan") { int s = 0; for (std::size_t i = 0; i != numOperands; ++i) s += log_floori_bit_scan(ua[i]); return s; };
+}
+
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
@@ -0,0 +1,99 @@
+
+#include <array>
+#include <random>
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <slowmath/arithmetic.hpp>
+#include <slowmath/telemetry.hpp>
+
+
+namespace {
+
+
+constexpr std::size_t numOperands = 1024;
+
+template <typename T>
+using operands = std::array<T, numOperands>;
+
+    // Generates signed operands of magnitude at most 2ⁿ⁻¹.
+operands<std::int64_t>
+make_operands(std::mt19937_64& rng, int numBits)
+{
+    auto result = operands<std::int64_t>{ };
+    for (auto& x : result)
+    {
+        x = std::int64_t(rng() >> (64 - numBits)) - (std::int64_t(1) << (numBits - 1));
+    }
+    return result;
+}
+
+    // The finalizer of MurmurHash3, which stands in for the other work done per row of a table.
+std::uint64_t
+mix(std::uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+
+} // anonymous namespace
+
+
+TEST_CASE("headroom profiling", "[!benchmark][telemetry]")
+{
+    SLOWMATH_CALL_SITE(benchmarkProduct);
+    using throw_eh = slowmath::throw_error_handler;
+    using profiled = slowmath::headroom_error_handler<throw_eh, benchmarkProduct, slowmath::arithmetic_operation::multiply>;
+
+    auto rng = std::mt19937_64(42);
+    auto a = make_operands(rng, 20);
+    auto b = make_operands(rng, 20);
+    auto keys = std::array<operands<std::uint64_t>, 4>{ };
+    for (auto& k : keys)
+    {
+        for (auto& x : k)
+        {
+            x = rng();
+        }
+    }
+
+        // Establish the bounds before measuring the steady state.
+    for (std::size_t i = 0; i != numOperands; ++i)
+    {
+        (void) slowmath::multiply<profiled>(a[i], b[i]);
+    }
+
+        // The operation alone: the worst case for the profiler.
+    BENCHMARK("multiply<throw_error_handler>()") { std::int64_t s = 0; for (std::size_t i = 0; i != numOperands; ++i) s += slowmath::multiply<throw_eh>(a[i], b[i]); return s; };
+    BENCHMARK("multiply<headroom_error_handler<>>()") { std::int64_t s = 0; for (std::size_t i = 0; i != numOperands; ++i) s += slowmath::multiply<profiled>(a[i], b[i]); return s; };
+
+        // One profiled operation per row of a table whose key columns are hashed.
+    BENCHMARK("row hash, multiply<throw_error_handler>()")
+    {
+        std::uint64_t s = 0;
+        for (std::size_t i = 0; i != numOperands; ++i)
+        {
+            auto bytes = slowmath::multiply<throw_eh>(a[i], b[i]);
+            s += mix(keys[0][i] ^ mix(keys[1][i] ^ mix(keys[2][i] ^ mix(keys[3][i])))) + std::uint64_t(bytes);
+        }
+        return s;
+    };
+    BENCHMARK("row hash, multiply<headroom_error_handler<>>()")
+    {
+        std::uint64_t s = 0;
+        for (std::size_t i = 0; i != numOperands; ++i)
+        {
+            auto bytes = slowmath::multiply<profiled>(a[i], b[i]);
+            s += mix(keys[0][i] ^ mix(keys[1][i] ^ mix(keys[2][i] ^ mix(keys[3][i])))) + std::uint64_t(bytes);
+        }
+        return s;
+    };
+}
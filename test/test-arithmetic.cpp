@@ -1,6 +1,10 @@
 ﻿
 #include <tuple>
+#include <vector>
 #include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_template_test_macros.hpp>
@@ -70,8 +74,111 @@ TEMPLATE_TEST_CASE("absi(), negate() for unsigned types", "[arithmetic]", std::u
 }
 
 
-// TODO: add comprehensive tests for add()
-// TODO: add comprehensive tests for subtract()
+TEMPLATE_TEST_CASE("add(), subtract() for signed types", "[arithmetic]", std::int8_t, std::int32_t, std::int64_t)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    SECTION("basic correctness")
+    {
+        auto a = GENERATE(range(TestType(-7), TestType(8)));
+        auto b = GENERATE(range(TestType(-7), TestType(8)));
+
+        CAPTURE(a);
+        CAPTURE(b);
+        CHECK(slowmath::add_checked(a, b) == a + b);
+        CHECK(slowmath::subtract_checked(a, b) == a - b);
+    }
+
+    SECTION("borderline values")
+    {
+        CHECK(slowmath::add_checked(iMax, TestType(0)) == iMax);
+        CHECK(slowmath::add_checked(iMin, TestType(0)) == iMin);
+        CHECK(slowmath::add_checked(iMax, iMin) == -1);
+        CHECK(slowmath::add_checked(TestType(iMax - 1), TestType(1)) == iMax);
+        CHECK(slowmath::add_checked(TestType(iMin + 1), TestType(-1)) == iMin);
+        CHECK(slowmath::subtract_checked(iMax, iMax) == 0);
+        CHECK(slowmath::subtract_checked(iMin, iMin) == 0);
+        CHECK(slowmath::subtract_checked(TestType(-1), iMax) == iMin);
+        CHECK(slowmath::subtract_checked(TestType(0), iMax) == iMin + 1);
+        CHECK(slowmath::subtract_checked(TestType(-1), iMin) == iMax);
+    }
+
+    SECTION("throws on integer overflow")
+    {
+        CHECK_THROWS_AS(slowmath::add_checked(iMax, TestType(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::add_checked(iMin, TestType(-1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::add_checked(iMax, iMax), std::system_error);
+        CHECK_THROWS_AS(slowmath::add_checked(iMin, iMin), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(iMin, TestType(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(iMax, TestType(-1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(TestType(0), iMin), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(iMax, iMin), std::system_error);
+    }
+
+    SECTION("reports overflow with all error handlers")
+    {
+        CHECK(slowmath::try_add(iMax, TestType(1)).ec == std::errc::value_too_large);
+        CHECK(slowmath::try_subtract(iMin, TestType(1)).ec == std::errc::value_too_large);
+        CHECK(slowmath::try_multiply(iMin, TestType(-1)).ec == std::errc::value_too_large);
+        CHECK(slowmath::try_add(iMax, TestType(-1)).value == iMax - 1);
+        CHECK_THROWS(slowmath::add_failfast(iMax, TestType(1)));
+        CHECK_THROWS(slowmath::subtract_failfast(iMin, TestType(1)));
+        CHECK_THROWS(slowmath::multiply_failfast(iMax, TestType(2)));
+    }
+}
+
+TEMPLATE_TEST_CASE("add(), subtract() for unsigned types", "[arithmetic]", std::uint8_t, std::uint32_t, std::uint64_t)
+{
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    SECTION("basic correctness")
+    {
+        auto a = GENERATE(range(TestType(0), TestType(8)));
+        auto b = GENERATE(range(TestType(0), TestType(8)));
+
+        CAPTURE(a);
+        CAPTURE(b);
+        CHECK(slowmath::add_checked(a, b) == TestType(a + b));
+        if (a >= b)
+        {
+            CHECK(slowmath::subtract_checked(a, b) == TestType(a - b));
+        }
+        else
+        {
+            CHECK_THROWS_AS(slowmath::subtract_checked(a, b), std::system_error);
+        }
+    }
+
+    SECTION("borderline values")
+    {
+        CHECK(slowmath::add_checked(iMax, TestType(0)) == iMax);
+        CHECK(slowmath::add_checked(TestType(iMax - 1), TestType(1)) == iMax);
+        CHECK(slowmath::subtract_checked(iMax, iMax) == 0);
+        CHECK(slowmath::subtract_checked(iMax, TestType(0)) == iMax);
+    }
+
+    SECTION("throws on integer overflow")
+    {
+        CHECK_THROWS_AS(slowmath::add_checked(iMax, TestType(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::add_checked(iMax, iMax), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(TestType(0), TestType(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(TestType(0), iMax), std::system_error);
+    }
+}
+
+TEST_CASE("add(), subtract(), multiply() can be used in constant expressions")
+{
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+
+    static_assert(slowmath::add_checked(iMax - 1, std::int64_t(1)) == iMax, "");
+    static_assert(slowmath::subtract_checked(-iMax, std::int64_t(1)) == -iMax - 1, "");
+    static_assert(slowmath::multiply_checked(uMax / 3, std::uint64_t(3)) == uMax, "");
+    static_assert(slowmath::try_add(iMax, std::int64_t(1)).ec == std::errc::value_too_large, "");
+    static_assert(slowmath::try_subtract(std::uint64_t(0), std::uint64_t(1)).ec == std::errc::value_too_large, "");
+    static_assert(slowmath::try_multiply(uMax / 2, std::uint64_t(3)).ec == std::errc::value_too_large, "");
+}
 
 
 TEMPLATE_TEST_CASE("multiply() for signed types", "[arithmetic]", std::int8_t, std::int32_t, std::int64_t)
@@ -186,5 +293,1293 @@ TEMPLATE_TEST_CASE("multiply() for unsigned types", "[arithmetic]", std::uint8_t
 }
 
 
+TEMPLATE_TEST_CASE("add_to(), subtract_to(), multiply_to()", "[arithmetic]", std::int8_t, std::uint8_t, std::int16_t, std::uint16_t)
+{
+    using R = TestType;
+
+    SECTION("agree with exact arithmetic for 8-bit arguments")
+    {
+        auto rMin = int(std::numeric_limits<R>::min());
+        auto rMax = int(std::numeric_limits<R>::max());
+        for (int a : { -128, -127, -65, -64, -2, -1, 0, 1, 2, 63, 64, 127, 128, 200, 254, 255 })
+        {
+            for (int b : { -128, -127, -64, -2, -1, 0, 1, 2, 63, 64, 126, 127 })
+            {
+                    // Mix arguments of different signedness.
+                auto check = [&](auto ta, auto tb)
+                {
+                    auto sum = slowmath::try_add_to<R>(ta, tb);
+                    auto difference = slowmath::try_subtract_to<R>(ta, tb);
+                    auto product = slowmath::try_multiply_to<R>(ta, tb);
+                    CHECK((sum.ec == std::errc{ }) == (a + b >= rMin && a + b <= rMax));
+                    CHECK((difference.ec == std::errc{ }) == (a - b >= rMin && a - b <= rMax));
+                    CHECK((product.ec == std::errc{ }) == (a * b >= rMin && a * b <= rMax));
+                    if (sum.ec == std::errc{ }) CHECK(int(sum.value) == a + b);
+                    if (difference.ec == std::errc{ }) CHECK(int(difference.value) == a - b);
+                    if (product.ec == std::errc{ }) CHECK(int(product.value) == a * b);
+                };
+                CAPTURE(a);
+                CAPTURE(b);
+                if (a >= 0) check(std::uint8_t(a), std::int8_t(b));
+                if (a < 128) check(std::int8_t(a), std::int8_t(b));
+            }
+        }
+    }
+}
+
+TEST_CASE("add_to(), subtract_to(), multiply_to() with arguments of different signedness", "[arithmetic]")
+{
+    static constexpr auto i64Min = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto i64Max = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto u64Max = std::numeric_limits<std::uint64_t>::max();
+
+    SECTION("basic correctness")
+    {
+        std::size_t pos = 10;
+        std::ptrdiff_t delta = -3;
+        CHECK(slowmath::add_to_checked<std::size_t>(pos, delta) == 7);
+        CHECK(slowmath::subtract_to_checked<std::size_t>(pos, delta) == 13);
+        CHECK(slowmath::add_to_checked<std::ptrdiff_t>(pos, delta) == 7);
+        CHECK(slowmath::subtract_to_checked<std::ptrdiff_t>(std::size_t(3), pos) == -7);
+        CHECK(slowmath::multiply_to_checked<std::ptrdiff_t>(pos, delta) == -30);
+        CHECK(slowmath::multiply_to_checked<std::int32_t>(std::uint64_t(1) << 20, std::int8_t(-2)) == -(1 << 21));
+        CHECK(slowmath::add_to_checked<std::uint8_t>(std::int64_t(-1), std::uint64_t(256)) == 255);
+        CHECK(slowmath::add_to_checked<std::int64_t>(3, 4) == 7);
+    }
+
+    SECTION("borderline values")
+    {
+        CHECK(slowmath::add_to_checked<std::uint64_t>(u64Max, std::int64_t(-1)) == u64Max - 1);
+        CHECK(slowmath::add_to_checked<std::int64_t>(u64Max, i64Min) == i64Max);
+        CHECK(slowmath::subtract_to_checked<std::int64_t>(std::uint64_t(0), std::uint64_t(i64Max) + 1) == i64Min);
+        CHECK(slowmath::subtract_to_checked<std::uint64_t>(std::int64_t(-1), i64Min) == std::uint64_t(i64Max));
+        CHECK(slowmath::subtract_to_checked<std::uint64_t>(i64Max, i64Min) == u64Max);
+        CHECK(slowmath::multiply_to_checked<std::int64_t>(std::uint64_t(1) << 62, std::int64_t(-2)) == i64Min);
+        CHECK(slowmath::multiply_to_checked<std::uint64_t>(i64Min, std::int64_t(-1)) == std::uint64_t(1) << 63);
+        CHECK(slowmath::multiply_to_checked<std::uint64_t>(std::uint64_t(0), i64Min) == 0);
+    }
+
+    SECTION("reports overflow with all error handlers")
+    {
+        CHECK_THROWS_AS(slowmath::add_to_checked<std::size_t>(std::size_t(2), std::ptrdiff_t(-3)), std::system_error);
+        CHECK_THROWS_AS(slowmath::add_to_checked<std::uint64_t>(u64Max, std::int64_t(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::add_to_checked<std::int64_t>(std::uint64_t(i64Max), std::int64_t(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_to_checked<std::int64_t>(std::uint64_t(0), u64Max), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_to_checked<std::uint64_t>(std::int64_t(-1), std::uint64_t(0)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_to_checked<std::int64_t>(std::uint64_t(1) << 62, std::int64_t(2)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_to_checked<std::uint64_t>(std::uint64_t(1), std::int64_t(-1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_to_checked<std::int64_t>(u64Max, u64Max), std::system_error);
+        CHECK(slowmath::try_add_to<std::size_t>(std::size_t(0), std::ptrdiff_t(-1)).ec == std::errc::value_too_large);
+        CHECK(slowmath::try_subtract_to<std::int8_t>(0, 129).ec == std::errc::value_too_large);
+        CHECK(slowmath::try_multiply_to<std::uint32_t>(-1, -1).value == 1);
+        CHECK_THROWS(slowmath::add_to_failfast<std::uint32_t>(0, -1));
+        CHECK_THROWS(slowmath::subtract_to_failfast<std::int32_t>(0u, 0x8000'0001u));
+        CHECK_THROWS(slowmath::multiply_to_failfast<std::uint16_t>(256, 256));
+    }
+
+    SECTION("can be used in constant expressions")
+    {
+        static_assert(slowmath::add_to_checked<std::size_t>(std::size_t(10), std::ptrdiff_t(-3)) == 7, "");
+        static_assert(slowmath::subtract_to_checked<std::int64_t>(std::uint64_t(0), std::uint64_t(i64Max) + 1) == i64Min, "");
+        static_assert(slowmath::subtract_to_checked<std::uint64_t>(i64Max, i64Min) == u64Max, "");
+        static_assert(slowmath::multiply_to_checked<std::int64_t>(std::uint64_t(1) << 62, std::int64_t(-2)) == i64Min, "");
+        static_assert(slowmath::try_multiply_to<std::int64_t>(u64Max, std::int64_t(-1)).ec == std::errc::value_too_large, "");
+        static_assert(slowmath::try_add_to<std::uint64_t>(u64Max, std::int64_t(1)).ec == std::errc::value_too_large, "");
+    }
+}
+
+TEST_CASE("an explicit template argument of add(), subtract(), multiply() specifies the type of the first argument", "[arithmetic]")
+{
+    static constexpr auto i32Max = std::numeric_limits<std::int32_t>::max();
+
+        // The result type is the common type of the argument types, so the result is not narrowed to the explicit type.
+    static_assert(std::is_same<decltype(slowmath::add_checked<std::int64_t>(3, 4)), std::int64_t>::value, "");
+    static_assert(std::is_same<decltype(slowmath::multiply_checked<std::int8_t>(std::int8_t(100), 100)), int>::value, "");
+    CHECK(slowmath::add_checked<std::int64_t>(i32Max, 1) == std::int64_t(i32Max) + 1);
+    CHECK(slowmath::multiply_checked<std::int8_t>(std::int8_t(100), 100) == 10000);
+    CHECK(slowmath::try_subtract<std::int16_t>(std::int16_t(-300), 200).value == -500);
+    CHECK(slowmath::multiply_failfast<std::int64_t>(i32Max, 2) == 2 * std::int64_t(i32Max));
+    CHECK_THROWS_AS(slowmath::add_checked<std::int32_t>(i32Max, std::int32_t(1)), std::system_error);
+}
+
+TEST_CASE("add_to(), subtract_to(), multiply_to() take the result type before the error handler", "[arithmetic]")
+{
+    static constexpr auto i32Max = std::numeric_limits<std::int32_t>::max();
+
+    static_assert(slowmath::add_to<std::int64_t>(i32Max, 1) == std::int64_t(i32Max) + 1, "");
+    static_assert(slowmath::subtract_to<std::int32_t>(3u, 4u) == -1, "");
+    static_assert(std::is_same<decltype(slowmath::multiply_to<std::int64_t>(2, 3)), std::int64_t>::value, "");
+    CHECK(slowmath::add_to<std::int64_t, slowmath::try_error_handler>(i32Max, 1).value == std::int64_t(i32Max) + 1);
+    CHECK(slowmath::subtract_to<std::uint32_t, slowmath::try_error_handler>(3, 4).ec == std::errc::value_too_large);
+    CHECK(slowmath::multiply_to<std::int16_t, slowmath::try_error_handler>(std::uint8_t(200), std::int8_t(-100)).value == -20000);
+    CHECK_THROWS_AS((slowmath::multiply_to<std::int8_t, slowmath::throw_error_handler>(100u, 2)), std::system_error);
+}
+
+TEMPLATE_TEST_CASE("multiply_add(), multiply_subtract()", "[arithmetic]", std::int8_t, std::uint8_t)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto a = GENERATE(range(int(iMin), int(iMax) + 1, 7));
+    auto b = GENERATE(range(int(iMin), int(iMax) + 1, 11));
+    auto c = GENERATE(int(iMin), int(iMin) + 1, -1, 0, 1, int(iMax) - 1, int(iMax));
+    if (c < int(iMin)) return;
+
+    CAPTURE(a);
+    CAPTURE(b);
+    CAPTURE(c);
+
+    int sum = a*b + c;
+    auto rsum = slowmath::try_multiply_add(TestType(a), TestType(b), TestType(c));
+    CHECK((rsum.ec == std::errc{ }) == (sum >= int(iMin) && sum <= int(iMax)));
+    if (rsum.ec == std::errc{ }) CHECK(int(rsum.value) == sum);
+
+    int difference = a*b - c;
+    auto rdifference = slowmath::try_multiply_subtract(TestType(a), TestType(b), TestType(c));
+    CHECK((rdifference.ec == std::errc{ }) == (difference >= int(iMin) && difference <= int(iMax)));
+    if (rdifference.ec == std::errc{ }) CHECK(int(rdifference.value) == difference);
+}
+
+TEST_CASE("multiply_add(), multiply_subtract() check only the final result", "[arithmetic]")
+{
+    static constexpr auto iMin = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+    static constexpr auto i62 = std::int64_t(1) << 62;
+
+        // a ∙ b overflows, but a ∙ b ± c does not
+    CHECK(slowmath::multiply_add_checked(i62, std::int64_t(2), std::int64_t(-1)) == iMax);
+    CHECK(slowmath::multiply_subtract_checked(i62, std::int64_t(2), std::int64_t(1)) == iMax);
+    CHECK(slowmath::multiply_add_checked(-i62, std::int64_t(-2), std::int64_t(-1)) == iMax);
+    CHECK(slowmath::multiply_add_checked(i62, std::int64_t(-2), std::int64_t(0)) == iMin);
+    CHECK(slowmath::multiply_subtract_checked(std::uint64_t(1) << 32, std::uint64_t(1) << 32, std::uint64_t(1)) == uMax);
+    CHECK(slowmath::multiply_add_failfast(uMax / 3, std::uint64_t(3), std::uint64_t(0)) == uMax);
+    CHECK(slowmath::multiply_add(std::size_t(10), std::size_t(24), std::size_t(16)) == 256);
+
+    CHECK_THROWS_AS(slowmath::multiply_add_checked(i62, std::int64_t(2), std::int64_t(0)), std::system_error);
+    CHECK_THROWS_AS(slowmath::multiply_add_checked(-i62, std::int64_t(2), std::int64_t(-1)), std::system_error);
+    CHECK_THROWS_AS(slowmath::multiply_add_checked(std::uint64_t(1) << 32, std::uint64_t(1) << 32, std::uint64_t(0)), std::system_error);
+    CHECK_THROWS_AS(slowmath::multiply_add_checked(uMax, std::uint64_t(1), std::uint64_t(1)), std::system_error);
+    CHECK_THROWS_AS(slowmath::multiply_subtract_checked(std::uint64_t(0), uMax, std::uint64_t(1)), std::system_error);
+    CHECK(slowmath::try_multiply_subtract(iMin, std::int64_t(1), std::int64_t(1)).ec == std::errc::value_too_large);
+
+    static_assert(slowmath::multiply_add_checked(i62, std::int64_t(2), std::int64_t(-1)) == iMax, "");
+    static_assert(slowmath::try_multiply_add(uMax, std::uint64_t(2), std::uint64_t(0)).ec == std::errc::value_too_large, "");
+}
+
+TEMPLATE_TEST_CASE("add_saturating(), subtract_saturating(), multiply_saturating()", "[arithmetic]", std::int8_t, std::uint8_t)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto a = GENERATE(range(int(iMin), int(iMax) + 1, 7));
+    auto b = GENERATE(range(int(iMin), int(iMax) + 1, 11));
+
+    CAPTURE(a);
+    CAPTURE(b);
+
+    auto clamp = [](int v) { return v < int(iMin) ? int(iMin) : v > int(iMax) ? int(iMax) : v; };
+    CHECK(int(slowmath::add_saturating(TestType(a), TestType(b))) == clamp(a + b));
+    CHECK(int(slowmath::subtract_saturating(TestType(a), TestType(b))) == clamp(a - b));
+    CHECK(int(slowmath::multiply_saturating(TestType(a), TestType(b))) == clamp(a*b));
+}
+
+TEST_CASE("add_saturating(), subtract_saturating(), multiply_saturating() for 64-bit operands", "[arithmetic]")
+{
+    static constexpr auto iMin = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+
+    CHECK(slowmath::add_saturating(iMax, std::int64_t(1)) == iMax);
+    CHECK(slowmath::add_saturating(iMin, std::int64_t(-1)) == iMin);
+    CHECK(slowmath::add_saturating(iMin, iMax) == -1);
+    CHECK(slowmath::subtract_saturating(iMin, std::int64_t(1)) == iMin);
+    CHECK(slowmath::subtract_saturating(std::int64_t(0), iMin) == iMax);
+    CHECK(slowmath::subtract_saturating(std::int64_t(-1), iMin) == iMax);
+    CHECK(slowmath::multiply_saturating(iMin, std::int64_t(-1)) == iMax);
+    CHECK(slowmath::multiply_saturating(iMax, std::int64_t(-2)) == iMin);
+    CHECK(slowmath::multiply_saturating(iMax, std::int64_t(-1)) == -iMax);
+    CHECK(slowmath::multiply_saturating(std::int64_t(1) << 32, std::int64_t(1) << 31) == iMax);
+
+    CHECK(slowmath::add_saturating(uMax, std::uint64_t(1)) == uMax);
+    CHECK(slowmath::add_saturating(uMax - 1, std::uint64_t(1)) == uMax);
+    CHECK(slowmath::subtract_saturating(std::uint64_t(0), std::uint64_t(1)) == 0);
+    CHECK(slowmath::subtract_saturating(uMax, uMax) == 0);
+    CHECK(slowmath::multiply_saturating(std::uint64_t(1) << 32, std::uint64_t(1) << 32) == uMax);
+    CHECK(slowmath::multiply_saturating(uMax, std::uint64_t(1)) == uMax);
+
+    static_assert(slowmath::add_saturating(iMax, iMax) == iMax, "");
+    static_assert(slowmath::subtract_saturating(iMin, iMax) == iMin, "");
+    static_assert(slowmath::multiply_saturating(iMin, iMin) == iMax, "");
+    static_assert(slowmath::multiply_saturating(uMax, uMax) == uMax, "");
+}
+
+TEMPLATE_TEST_CASE("overflow_accumulator", "[arithmetic]", std::int8_t, std::uint8_t)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto a = GENERATE(range(int(iMin), int(iMax) + 1, 13));
+    auto b = GENERATE(range(int(iMin), int(iMax) + 1, 17));
+
+    CAPTURE(a);
+    CAPTURE(b);
+
+    auto fits = [](int v) { return v >= int(iMin) && v <= int(iMax); };
+    auto check = [&](int expected, auto op)
+    {
+        auto acc = slowmath::overflow_accumulator{ };
+        auto r = op(acc);
+        CHECK(r == TestType(expected));
+        CHECK(acc.overflow() == !fits(expected));
+        CHECK((acc.ec() == std::errc{ }) == fits(expected));
+    };
+    check(a + b, [&](slowmath::overflow_accumulator& acc) { return acc.add(TestType(a), TestType(b)); });
+    check(a - b, [&](slowmath::overflow_accumulator& acc) { return acc.subtract(TestType(a), TestType(b)); });
+    check(a*b, [&](slowmath::overflow_accumulator& acc) { return acc.multiply(TestType(a), TestType(b)); });
+    check(-a, [&](slowmath::overflow_accumulator& acc) { return acc.negate(TestType(a)); });
+    check(a < 0 ? -a : a, [&](slowmath::overflow_accumulator& acc) { return acc.absi(TestType(a)); });
+    check(a*b, [&](slowmath::overflow_accumulator& acc) { return acc.narrow<TestType>(a*b); });
+}
+
+TEST_CASE("overflow_accumulator records overflow for a sequence of operations", "[arithmetic]")
+{
+    static constexpr auto iMin = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+
+    auto acc = slowmath::overflow_accumulator{ };
+    CHECK(acc.add(iMax - 1, std::int64_t(1)) == iMax);
+    CHECK(acc.multiply(std::int64_t(1) << 31, -(std::int64_t(1) << 32)) == iMin);
+    CHECK(acc.subtract(std::uint64_t(1), std::uint64_t(1)) == 0);
+    CHECK(acc.narrow<std::uint32_t>(std::int64_t(4294967295)) == 4294967295u);
+    CHECK_FALSE(acc.overflow());
+    CHECK_NOTHROW(acc.check());
+    acc.check_failfast();
+
+    CHECK(acc.multiply(uMax, std::uint64_t(2)) == uMax - 1);
+    CHECK(acc.add(std::int64_t(0), std::int64_t(1)) == 1);
+    CHECK(acc.overflow());
+    CHECK(acc.ec() == std::errc::value_too_large);
+    CHECK_THROWS_AS(acc.check(), std::system_error);
+    acc.reset();
+    CHECK_FALSE(acc.overflow());
+
+    CHECK(acc.subtract(iMin, std::int64_t(1)) == iMax);
+    CHECK(acc.overflow());
+    acc.reset();
+    CHECK(acc.multiply(iMin, std::int64_t(-1)) == iMin);
+    CHECK(acc.overflow());
+    acc.reset();
+    CHECK(acc.negate(std::uint64_t(1)) == uMax);
+    CHECK(acc.overflow());
+    acc.reset();
+    CHECK(acc.narrow<std::int8_t>(std::uint64_t(128)) == -128);
+    CHECK(acc.overflow());
+
+    static_assert(slowmath::overflow_accumulator{ }.add(iMax, iMax) == -2, "");
+    static_assert(slowmath::overflow_accumulator{ }.multiply(uMax, uMax) == 1, "");
+}
+
+TEMPLATE_TEST_CASE("multiply_extended(), add_with_carry(), subtract_with_borrow()", "[arithmetic]", std::int8_t, std::uint8_t)
+{
+    using U = std::make_unsigned_t<TestType>;
+
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto a = GENERATE(range(int(iMin), int(iMax) + 1, 7));
+    auto b = GENERATE(range(int(iMin), int(iMax) + 1, 11));
+
+    CAPTURE(a);
+    CAPTURE(b);
+
+    auto p = slowmath::multiply_extended(TestType(a), TestType(b));
+    CHECK(int(p.hi) * 256 + int(p.lo) == a*b);
+
+    if (std::is_unsigned<TestType>::value)
+    {
+        for (bool carryIn : { false, true })
+        {
+            auto s = slowmath::add_with_carry(U(a), U(b), carryIn);
+            CHECK(int(s.value) + (s.carry ? 256 : 0) == a + b + int(carryIn));
+
+            auto d = slowmath::subtract_with_borrow(U(a), U(b), carryIn);
+            CHECK(int(d.value) - (d.carry ? 256 : 0) == a - b - int(carryIn));
+        }
+    }
+}
+
+TEST_CASE("multiply_extended(), add_with_carry(), subtract_with_borrow() for 64-bit operands", "[arithmetic]")
+{
+    static constexpr auto iMin = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+
+    CHECK(slowmath::multiply_extended(uMax, uMax) == slowmath::extended_product<std::uint64_t>{ uMax - 1, 1 });
+    CHECK(slowmath::multiply_extended(std::uint64_t(1) << 32, std::uint64_t(1) << 32) == slowmath::extended_product<std::uint64_t>{ 1, 0 });
+    CHECK(slowmath::multiply_extended(iMin, iMin) == slowmath::extended_product<std::int64_t>{ std::int64_t(1) << 62, 0 });
+    CHECK(slowmath::multiply_extended(iMin, std::int64_t(-1)) == slowmath::extended_product<std::int64_t>{ 0, std::uint64_t(1) << 63 });
+    CHECK(slowmath::multiply_extended(iMax, std::int64_t(-1)) == slowmath::extended_product<std::int64_t>{ -1, (std::uint64_t(1) << 63) + 1 });
+    CHECK(slowmath::multiply_extended(std::int64_t(-3), std::int64_t(5)) == slowmath::extended_product<std::int64_t>{ -1, std::uint64_t(-15) });
+
+    CHECK(slowmath::add_with_carry(uMax, std::uint64_t(1)) == slowmath::carry_result<std::uint64_t>{ 0, true });
+    CHECK(slowmath::add_with_carry(uMax, uMax, true) == slowmath::carry_result<std::uint64_t>{ uMax, true });
+    CHECK(slowmath::add_with_carry(uMax - 1, std::uint64_t(0), true) == slowmath::carry_result<std::uint64_t>{ uMax, false });
+    CHECK(slowmath::subtract_with_borrow(std::uint64_t(0), std::uint64_t(0), true) == slowmath::carry_result<std::uint64_t>{ uMax, true });
+    CHECK(slowmath::subtract_with_borrow(std::uint64_t(0), uMax, true) == slowmath::carry_result<std::uint64_t>{ 0, true });
+    CHECK(slowmath::subtract_with_borrow(uMax, uMax, false) == slowmath::carry_result<std::uint64_t>{ 0, false });
+
+        // (2⁶⁴ - 1) ∙ 2⁶⁴ + (2⁶⁴ - 1) + 1 = 2¹²⁸, computed with two words
+    auto lo = slowmath::add_with_carry(uMax, std::uint64_t(1));
+    auto hi = slowmath::add_with_carry(uMax, std::uint64_t(0), lo.carry);
+    CHECK(lo.value == 0);
+    CHECK(hi.value == 0);
+    CHECK(hi.carry);
+
+    static_assert(slowmath::multiply_extended(uMax, uMax).hi == uMax - 1, "");
+    static_assert(slowmath::multiply_extended(iMin, iMin).hi == std::int64_t(1) << 62, "");
+    static_assert(slowmath::add_with_carry(uMax, uMax, true).carry, "");
+    static_assert(slowmath::subtract_with_borrow(std::uint64_t(1), std::uint64_t(0), true).value == 0, "");
+}
+
+    // Compares division with a `divider<>` with the built-in division for random operands whose magnitudes span the range of `V`.
+template <typename V>
+void
+check_divider_with_random_operands(std::uint64_t seed, int numDivisors)
+{
+    using U = slowmath::detail::make_unsigned_t<V>;
+
+    auto random = [&seed]
+    {
+        U bits = 0;
+        for (std::size_t i = 0; i != sizeof(V); ++i)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            bits = U(U(bits * 256u) | U(seed >> 56));
+        }
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        return V(bits >> ((seed >> 33) % (sizeof(V) * 8)));
+    };
+
+    for (int i = 0; i != numDivisors; ++i)
+    {
+        V d = random();
+        if (d == 0 || (slowmath::detail::is_signed_v<V> && d == V(-1))) continue;
+
+        auto dv = slowmath::divider<V>(d);
+        for (int j = 0; j != 16; ++j)
+        {
+            V n = random();
+            bool quotientMatches = slowmath::divide(n, dv) == V(n / d);
+            bool remainderMatches = slowmath::modulo(n, dv) == V(n % d);
+            bool divmodMatches = slowmath::try_divmod(n, dv).value == slowmath::divmod(n, d);
+            if (!quotientMatches || !remainderMatches || !divmodMatches)
+            {
+                    // Catch2 cannot print 128-bit integers, so we capture the operands as 64-bit words.
+                CAPTURE(std::uint64_t(U(n) >> (sizeof(V) * 4) >> (sizeof(V) * 4)), std::uint64_t(n), std::uint64_t(U(d) >> (sizeof(V) * 4) >> (sizeof(V) * 4)), std::uint64_t(d));
+                CHECK(quotientMatches);
+                CHECK(remainderMatches);
+                CHECK(divmodMatches);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("divide(), modulo(), divmod() with divider", "[arithmetic]", std::int8_t, std::uint8_t)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto n = GENERATE(range(int(iMin), int(iMax) + 1, 5));
+    auto d = GENERATE(range(int(iMin), int(iMax) + 1, 7));
+    if (d == 0 || d == -1) return;
+
+    CAPTURE(n);
+    CAPTURE(d);
+
+    auto dv = slowmath::divider<TestType>(TestType(d));
+    CHECK(dv.divisor() == TestType(d));
+    CHECK(int(slowmath::divide(TestType(n), dv)) == n / d);
+    CHECK(int(slowmath::modulo(TestType(n), dv)) == n % d);
+    CHECK(slowmath::divmod(TestType(n), dv) == slowmath::divmod(TestType(n), TestType(d)));
+}
+
+TEST_CASE("divide(), modulo(), divmod() with divider for 64-bit operands", "[arithmetic]")
+{
+    static constexpr auto iMin = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+
+    SECTION("signed")
+    {
+        auto d = GENERATE(iMin, iMin + 1, std::int64_t(-1000003), std::int64_t(-2), std::int64_t(1), std::int64_t(2), std::int64_t(3), std::int64_t(7), std::int64_t(1) << 32, std::int64_t(1000003), iMax - 1, iMax);
+
+        CAPTURE(d);
+
+        auto dv = slowmath::divider<std::int64_t>(d);
+        for (std::int64_t n : { iMin, iMin + 1, std::int64_t(-1000004), std::int64_t(-7), std::int64_t(-1), std::int64_t(0), std::int64_t(1), std::int64_t(6), std::int64_t(7), std::int64_t(1000002), iMax - 1, iMax })
+        {
+            CAPTURE(n);
+            CHECK(slowmath::divide(n, dv) == n / d);
+            CHECK(slowmath::modulo(n, dv) == n % d);
+            CHECK(slowmath::divmod(n, dv) == slowmath::divmod_result<std::int64_t>{ n / d, n % d });
+        }
+    }
+
+    SECTION("unsigned")
+    {
+        auto d = GENERATE(std::uint64_t(1), std::uint64_t(2), std::uint64_t(3), std::uint64_t(7), std::uint64_t(641), std::uint64_t(1) << 63, (std::uint64_t(1) << 63) + 1, uMax - 1, uMax);
+
+        CAPTURE(d);
+
+        auto dv = slowmath::divider<std::uint64_t>(d);
+        for (std::uint64_t n : { std::uint64_t(0), std::uint64_t(1), std::uint64_t(6), std::uint64_t(7), std::uint64_t(1) << 63, (std::uint64_t(1) << 63) + 1, uMax - 1, uMax })
+        {
+            CAPTURE(n);
+            CHECK(slowmath::divide(n, dv) == n / d);
+            CHECK(slowmath::modulo(n, dv) == n % d);
+        }
+        CHECK(slowmath::divide(std::uint32_t(4000000000u), dv) == 4000000000u / d);
+    }
+
+    SECTION("enforces preconditions")
+    {
+        CHECK_THROWS(slowmath::divider<std::int64_t>(0));
+        CHECK_THROWS(slowmath::divider<std::int64_t>(-1));
+        CHECK_THROWS(slowmath::divider<std::uint64_t>(0));
+        CHECK_NOTHROW(slowmath::divider<std::uint64_t>(uMax));
+        CHECK_THROWS(slowmath::divmod(1, 0));
+    }
+
+    SECTION("can be used in constant expressions")
+    {
+        constexpr auto dv = slowmath::divider<std::int64_t>(-10);
+        static_assert(slowmath::divide(std::int64_t(-123), dv) == 12, "");
+        static_assert(slowmath::modulo(-123, dv) == -3, "");
+        static_assert(slowmath::divmod(123, -10) == slowmath::divmod_result<int>{ -12, 3 }, "");
+        static_assert(slowmath::divmod_checked(-123, dv) == slowmath::divmod_result<std::int64_t>{ 12, -3 }, "");
+    }
+}
+
+TEST_CASE("divmod() checks for overflow", "[arithmetic]")
+{
+    static constexpr auto iMin = std::numeric_limits<std::int32_t>::min();
+
+    CHECK(slowmath::divmod_checked(iMin, -2) == slowmath::divmod_result<std::int32_t>{ -(iMin / 2), 0 });
+    CHECK(slowmath::divmod_failfast(7u, 2u) == slowmath::divmod_result<unsigned>{ 3, 1 });
+    CHECK(slowmath::try_divmod(iMin, -1).ec == std::errc::value_too_large);
+    CHECK(slowmath::divmod<slowmath::try_error_handler>(iMin, -1).ec == std::errc::value_too_large);
+    CHECK_THROWS_AS(slowmath::divmod_checked(iMin, -1), std::system_error);
+
+    auto dv = slowmath::divider<std::int32_t>(-2);
+    CHECK(slowmath::try_divmod(iMin, dv).ec == std::errc{ });
+    CHECK(slowmath::divmod_checked(iMin, dv) == slowmath::divmod_checked(iMin, -2));
+    CHECK(slowmath::divmod_failfast(-7, dv) == slowmath::divmod_result<std::int32_t>{ 3, -1 });
+
+        // The quotient and remainder of `std::integral_constant<>` arguments are computed at compile time.
+    auto c = slowmath::divmod(std::integral_constant<int, 7>{ }, std::integral_constant<int, -2>{ });
+    static_assert(std::is_same<decltype(c.quotient), std::integral_constant<int, -3>>::value, "");
+    static_assert(std::is_same<decltype(c.remainder), std::integral_constant<int, 1>>::value, "");
+}
+
+TEMPLATE_TEST_CASE("divide(), modulo(), divmod() with divider for random operands", "[arithmetic]", std::int16_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t)
+{
+    check_divider_with_random_operands<TestType>(42, 2000);
+}
+
+TEST_CASE("cmp_equal(), cmp_less() etc. compare arguments of different signedness", "[arithmetic]")
+{
+    static constexpr auto i64Min = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto u64Max = std::numeric_limits<std::uint64_t>::max();
+
+    CHECK(slowmath::cmp_less(-1, 0u));
+    CHECK_FALSE(slowmath::cmp_less(0u, -1));
+    CHECK(slowmath::cmp_greater(0u, -1));
+    CHECK(slowmath::cmp_less(i64Min, std::uint8_t(0)));
+    CHECK(slowmath::cmp_less(std::int32_t(-1), u64Max));
+    CHECK(slowmath::cmp_greater(u64Max, std::int64_t(-1)));
+    CHECK(slowmath::cmp_less(std::uint32_t(5), std::int64_t(6)));
+    CHECK_FALSE(slowmath::cmp_equal(-1, 0xFFFF'FFFFu));
+    CHECK(slowmath::cmp_not_equal(-1, 0xFFFF'FFFFu));
+    CHECK(slowmath::cmp_equal(std::uint64_t(7), std::int8_t(7)));
+    CHECK(slowmath::cmp_less_equal(std::size_t(7), std::ptrdiff_t(7)));
+    CHECK_FALSE(slowmath::cmp_less_equal(std::size_t(7), std::ptrdiff_t(-7)));
+    CHECK(slowmath::cmp_greater_equal(std::size_t(7), std::ptrdiff_t(-7)));
+    CHECK(slowmath::cmp_less(-2, -1));
+    CHECK(slowmath::cmp_less(1u, 2u));
+    CHECK(slowmath::cmp_less(std::integral_constant<int, -1>{ }, 0u));
+    static_assert(slowmath::cmp_less(-1, 0u), "");
+}
+
+TEMPLATE_TEST_CASE("multiply(), divide(), modulo() with constant operands", "[arithmetic]", std::int8_t, std::uint8_t, std::int32_t, std::uint64_t)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto check = [](TestType a, auto c)
+    {
+        CAPTURE(a);
+        CAPTURE(TestType(c));
+
+        auto r1 = slowmath::try_multiply(a, c);
+        auto r2 = slowmath::try_multiply(c, a);
+        auto r = slowmath::try_multiply(a, TestType(c));
+        CHECK(r1.ec == r.ec);
+        CHECK(r2.ec == r.ec);
+        if (r.ec == std::errc{ })
+        {
+            CHECK(r1.value == r.value);
+            CHECK(r2.value == r.value);
+        }
+        if (c != 0)
+        {
+            auto q1 = slowmath::try_divide(a, c);
+            auto q = slowmath::try_divide(a, TestType(c));
+            CHECK(q1.ec == q.ec);
+            if (q.ec == std::errc{ }) CHECK(q1.value == q.value);
+            auto m1 = slowmath::try_modulo(a, c);
+            auto m = slowmath::try_modulo(a, TestType(c));
+            CHECK(m1.ec == m.ec);
+            if (m.ec == std::errc{ }) CHECK(m1.value == m.value);
+        }
+    };
+    for (TestType a : { iMin, TestType(iMin + 1), TestType(iMin / 2), TestType(iMin / 3), TestType(-1), TestType(0), TestType(1), TestType(2), TestType(3), TestType(iMax / 3), TestType(iMax / 3 + 1), TestType(iMax / 2), TestType(iMax / 2 + 1), iMax })
+    {
+        check(a, std::integral_constant<TestType, 0>{ });
+        check(a, std::integral_constant<TestType, 1>{ });
+        check(a, std::integral_constant<TestType, 2>{ });
+        check(a, std::integral_constant<TestType, 3>{ });
+        check(a, std::integral_constant<TestType, 64>{ });
+        check(a, std::integral_constant<TestType, iMax>{ });
+        check(a, std::integral_constant<TestType, TestType(-1)>{ });
+        check(a, std::integral_constant<TestType, TestType(-2)>{ });
+        check(a, std::integral_constant<TestType, TestType(-3)>{ });
+        check(a, std::integral_constant<TestType, iMin>{ });
+    }
+    static_assert(slowmath::multiply_checked(TestType(3), std::integral_constant<TestType, 5>{ }) == 15, "");
+    static_assert(slowmath::try_multiply(iMax, std::integral_constant<TestType, 2>{ }).ec == std::errc::value_too_large, "");
+}
+
+TEST_CASE("operations on std::integral_constant<> arguments yield std::integral_constant<> results", "[arithmetic]")
+{
+    using std::integral_constant;
+    using std::is_same;
+
+    using I3 = integral_constant<int, 3>;
+    using I4 = integral_constant<int, 4>;
+    using U3 = integral_constant<unsigned, 3>;
+    using U8 = integral_constant<unsigned, 8>;
+    using N2 = integral_constant<int, -2>;
+
+    static_assert(is_same<decltype(slowmath::absi(N2{ })), integral_constant<int, 2>>::value, "");
+    static_assert(is_same<decltype(slowmath::negate_checked(I3{ })), integral_constant<int, -3>>::value, "");
+    static_assert(is_same<decltype(slowmath::add_checked(I3{ }, I4{ })), integral_constant<int, 7>>::value, "");
+    static_assert(is_same<decltype(slowmath::subtract_failfast(I3{ }, I4{ })), integral_constant<int, -1>>::value, "");
+    static_assert(is_same<decltype(slowmath::multiply_checked(U3{ }, U8{ })), integral_constant<unsigned, 24>>::value, "");
+    static_assert(is_same<decltype(slowmath::multiply_to_checked<long>(U3{ }, N2{ })), integral_constant<long, -6>>::value, "");
+    static_assert(is_same<decltype(slowmath::divide_checked(I4{ }, N2{ })), integral_constant<int, -2>>::value, "");
+    static_assert(is_same<decltype(slowmath::modulo(U8{ }, U3{ })), integral_constant<unsigned, 2>>::value, "");
+    static_assert(is_same<decltype(slowmath::square(N2{ })), integral_constant<int, 4>>::value, "");
+    static_assert(is_same<decltype(slowmath::powi_checked(U3{ }, U3{ })), integral_constant<unsigned, 27>>::value, "");
+    static_assert(is_same<decltype(slowmath::shift_left_checked(U3{ }, U3{ })), integral_constant<unsigned, 24>>::value, "");
+    static_assert(is_same<decltype(slowmath::shift_right(U8{ }, U3{ })), integral_constant<unsigned, 1>>::value, "");
+    static_assert(is_same<decltype(slowmath::floori(U8{ }, U3{ })), integral_constant<unsigned, 6>>::value, "");
+    static_assert(is_same<decltype(slowmath::ceili_checked(U8{ }, U3{ })), integral_constant<unsigned, 9>>::value, "");
+    static_assert(is_same<decltype(slowmath::ratio_floori(U8{ }, U3{ })), integral_constant<unsigned, 2>>::value, "");
+    static_assert(is_same<decltype(slowmath::ratio_ceili(U8{ }, U3{ })), integral_constant<unsigned, 3>>::value, "");
+    static_assert(is_same<decltype(slowmath::log_floori<int>(U8{ }, U3{ })), integral_constant<int, 1>>::value, "");
+    static_assert(is_same<decltype(slowmath::log_ceili<int>(U8{ }, U3{ })), integral_constant<int, 2>>::value, "");
+
+        // Results of operations on constants can be used as arguments again.
+    static_assert(is_same<decltype(slowmath::add_checked(slowmath::multiply_checked(U3{ }, U8{ }), U8{ })), integral_constant<unsigned, 32>>::value, "");
+
+        // If any of the arguments is not a constant, or if errors are returned as error codes, the result is not a constant.
+    static_assert(is_same<decltype(slowmath::add_checked(I3{ }, 4)), int>::value, "");
+    static_assert(is_same<decltype(slowmath::try_add(I3{ }, I4{ })), slowmath::arithmetic_result<int>>::value, "");
+
+    CHECK(slowmath::multiply_checked(U3{ }, U8{ }) == 24u);
+    CHECK(slowmath::try_add(I3{ }, I4{ }).value == 7);
+    CHECK(slowmath::try_square(N2{ }).value == 4);
+}
+
+TEST_CASE("portable double-word arithmetic")
+{
+    using slowmath::detail::double_word;
+    using slowmath::detail::fits;
+    using slowmath::detail::truncate;
+
+    static constexpr auto i64Min = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto i64Max = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto u64Max = std::numeric_limits<std::uint64_t>::max();
+
+    auto multiply = [](auto a, auto b)
+    {
+        return slowmath::detail::widening_multiply_0<decltype(a)>(std::true_type{ }, a, b);
+    };
+    auto add = [](auto a, auto b)
+    {
+        return slowmath::detail::widening_add_0<decltype(a)>(std::true_type{ }, a, b);
+    };
+    auto multiplyAdd = [](auto a, auto b, auto c)
+    {
+        return slowmath::detail::widening_multiply_add_0<decltype(a)>(std::true_type{ }, a, b, c);
+    };
+    auto multiplySubtract = [](auto a, auto b, auto c)
+    {
+        return slowmath::detail::widening_multiply_subtract_0<decltype(a)>(std::true_type{ }, a, b, c);
+    };
+
+    SECTION("unsigned")
+    {
+        auto p1 = multiply(u64Max, u64Max);
+        CHECK(p1.hi == u64Max - 1);
+        CHECK(p1.lo == 1);
+        CHECK_FALSE(fits<std::uint64_t>(p1));
+
+        auto p2 = multiply(std::uint64_t(0x1'0000'0000), std::uint64_t(0xFFFF'FFFF));
+        CHECK(p2.hi == 0);
+        CHECK(p2.lo == 0xFFFF'FFFF'0000'0000);
+        CHECK(fits<std::uint64_t>(p2));
+        CHECK(truncate<std::uint64_t>(p2) == 0xFFFF'FFFF'0000'0000);
+
+        auto s1 = add(u64Max, std::uint64_t(1));
+        CHECK(s1.hi == 1);
+        CHECK(s1.lo == 0);
+        CHECK_FALSE(fits<std::uint64_t>(s1));
+
+        auto ma1 = multiplyAdd(u64Max, u64Max, u64Max);
+        CHECK(ma1.hi == u64Max);
+        CHECK(ma1.lo == 0);
+        auto ms1 = multiplySubtract(std::uint64_t(0x1'0000'0000), std::uint64_t(0x1'0000'0000), std::uint64_t(1));
+        CHECK(fits<std::uint64_t>(ms1));
+        CHECK(truncate<std::uint64_t>(ms1) == u64Max);
+        CHECK_FALSE(fits<std::uint64_t>(multiplySubtract(std::uint64_t(0), std::uint64_t(0), std::uint64_t(1))));
+
+        auto q1 = slowmath::detail::divide_double_word(multiply(u64Max, u64Max - 1), u64Max);
+        CHECK(q1.quotient == u64Max - 1);
+        CHECK(q1.remainder == 0);
+        auto q2 = slowmath::detail::divide_double_word(double_word<std::uint64_t>{ 2, 5 }, std::uint64_t(3));
+        CHECK(q2.quotient == 0xAAAA'AAAA'AAAA'AAACu);
+        CHECK(q2.remainder == 1);
+        auto q3 = slowmath::detail::divide_double_word(double_word<std::uint64_t>{ 0x1234, 0x5678'9ABC'DEF0'1234 }, std::uint64_t(0x1'0000'0001));
+        CHECK(q3.quotient == 0x1234'5678'8888u);
+        CHECK(q3.remainder == 0x8877'89ACu);
+    }
+
+    SECTION("signed")
+    {
+        auto p1 = multiply(std::int64_t(-3), std::int64_t(5));
+        CHECK(p1.hi == -1);
+        CHECK(truncate<std::int64_t>(p1) == -15);
+        CHECK(fits<std::int64_t>(p1));
+
+        auto p2 = multiply(i64Min, std::int64_t(-1));
+        CHECK(p2.hi == 0);
+        CHECK(p2.lo == std::uint64_t(1) << 63);
+        CHECK_FALSE(fits<std::int64_t>(p2));
+
+        auto ma2 = multiplyAdd(i64Min, std::int64_t(-1), std::int64_t(-1));
+        CHECK(fits<std::int64_t>(ma2));
+        CHECK(truncate<std::int64_t>(ma2) == i64Max);
+        auto ms2 = multiplySubtract(i64Min, std::int64_t(1), std::int64_t(1));
+        CHECK(ms2.hi == -1);
+        CHECK_FALSE(fits<std::int64_t>(ms2));
+
+        auto p3 = multiply(i64Min, i64Min);
+        CHECK(p3.hi == std::int64_t(1) << 62);
+        CHECK(p3.lo == 0);
+        CHECK_FALSE(fits<std::int64_t>(p3));
+
+        auto p4 = multiply(i64Min, std::int64_t(1));
+        CHECK(fits<std::int64_t>(p4));
+        CHECK(truncate<std::int64_t>(p4) == i64Min);
+
+        auto p5 = multiply(i64Max, std::int64_t(-1));
+        CHECK(fits<std::int64_t>(p5));
+        CHECK(truncate<std::int64_t>(p5) == -i64Max);
+
+        auto s1 = add(i64Min, std::int64_t(-1));
+        CHECK(s1.hi == -1);
+        CHECK_FALSE(fits<std::int64_t>(s1));
+
+        auto s2 = add(i64Max, i64Min);
+        CHECK(fits<std::int64_t>(s2));
+        CHECK(truncate<std::int64_t>(s2) == -1);
+    }
+}
+
+
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+TEST_CASE("arithmetic with 128-bit operands", "[arithmetic]")
+{
+    using slowmath::detail::int128;
+    using slowmath::detail::uint128;
+    using slowmath::detail::fits;
+    using slowmath::detail::truncate;
+
+    static constexpr int128 iMin = slowmath::detail::min_v<int128>;
+    static constexpr int128 iMax = slowmath::detail::max_v<int128>;
+    static constexpr uint128 uMax = slowmath::detail::max_v<uint128>;
+    static constexpr int128 i64 = int128(1) << 64;
+    static constexpr uint128 u64 = uint128(1) << 64;
+
+    SECTION("signed")
+    {
+        CHECK(slowmath::add_checked(iMax, int128(-1)) == iMax - 1);
+        CHECK(slowmath::subtract_checked(iMin, int128(-1)) == iMin + 1);
+        CHECK(slowmath::absi_checked(iMin + 1) == iMax);
+        CHECK(slowmath::multiply_checked(iMin, int128(1)) == iMin);
+        CHECK(slowmath::multiply_checked(int128(1) << 63, -i64) == iMin);
+        CHECK(slowmath::multiply_checked(i64 - 1, int128(1) << 62) == (i64 - 1) * (int128(1) << 62));
+        CHECK(slowmath::multiply_checked(-(i64 - 1), (i64 - 1) >> 1) == -(i64 - 1) * ((i64 - 1) >> 1));
+        CHECK(slowmath::divide_checked(iMin, int128(2)) == iMin / 2);
+        CHECK(slowmath::shift_left_checked(int128(1), 126) == int128(1) << 126);
+        CHECK(slowmath::powi_checked(int128(-2), 127) == iMin);
+        CHECK(slowmath::powi_checked(int128(3), 80) == slowmath::multiply_checked(slowmath::powi_checked(int128(3), 40), slowmath::powi_checked(int128(3), 40)));
+        CHECK(slowmath::log_floori<int>(iMax, int128(2)) == 126);
+        CHECK(slowmath::log_ceili<int>(iMax, int128(2)) == 127);
+        CHECK(slowmath::log_floori<int>(slowmath::powi_checked(int128(7), 45), int128(7)) == 45);
+
+        CHECK_THROWS_AS(slowmath::add_checked(iMax, int128(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(iMin, int128(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::absi_checked(iMin), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_checked(iMin, int128(-1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_checked(int128(1) << 63, i64), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_checked(i64, -i64), std::system_error);
+        CHECK_THROWS_AS(slowmath::divide_checked(iMin, int128(-1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::shift_left_checked(int128(1), 127), std::system_error);
+        CHECK_THROWS_AS(slowmath::shift_right_checked(int128(1), 128), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(int128(2), 127), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(int128(-2), 128), std::system_error);
+        CHECK(slowmath::try_multiply(iMax, int128(2)).ec == std::errc::value_too_large);
+        CHECK(slowmath::multiply_saturating(iMax, int128(2)) == iMax);
+        CHECK(slowmath::multiply_saturating(iMin, i64) == iMin);
+        CHECK(slowmath::multiply_saturating(-i64, -i64) == iMax);
+        CHECK(slowmath::add_saturating(iMin, int128(-1)) == iMin);
+        CHECK(slowmath::powi_saturating(int128(-2), 129) == iMin);
+
+        auto acc = slowmath::overflow_accumulator{ };
+        CHECK(acc.multiply(i64 - 1, int128(1) << 62) == (i64 - 1) * (int128(1) << 62));
+        CHECK_FALSE(acc.overflow());
+        CHECK(acc.multiply(iMax, int128(2)) == -2);
+        CHECK(acc.overflow());
+
+        CHECK(slowmath::multiply_extended(iMin, iMin) == slowmath::extended_product<int128>{ int128(1) << 126, 0 });
+        CHECK(slowmath::multiply_extended(iMin, int128(-1)) == slowmath::extended_product<int128>{ 0, uint128(1) << 127 });
+        CHECK(slowmath::multiply_extended(int128(-3), i64) == slowmath::extended_product<int128>{ -1, uint128(-3) << 64 });
+    }
+
+    SECTION("unsigned")
+    {
+        CHECK(slowmath::add_checked(uMax - 1, uint128(1)) == uMax);
+        CHECK(slowmath::subtract_checked(uMax, uMax) == 0);
+        CHECK(slowmath::multiply_checked(u64 - 1, u64 + 1) == uMax);
+        CHECK(slowmath::multiply_checked(uMax, uint128(1)) == uMax);
+        CHECK(slowmath::shift_left_checked(uint128(1), 127) == uint128(1) << 127);
+        CHECK(slowmath::powi_checked(uint128(2), 127) == uint128(1) << 127);
+        CHECK(slowmath::log_floori<int>(uMax, uint128(2)) == 127);
+        CHECK(slowmath::log_ceili<int>(uMax, uint128(2)) == 128);
+        CHECK(slowmath::log_floori<int>(u64, uint128(10)) == 19);
+        CHECK(slowmath::log_floori<int>(uMax, uMax) == 1);
+        CHECK(slowmath::log_ceili<int>(uMax - 1, uMax) == 1);
+        static_assert(slowmath::log_floori<int>(uMax, uint128(3)) == 80, "");
+        static_assert(slowmath::log_ceili<int>(uMax, uint128(3)) == 81, "");
+        uint128 p3 = 1;
+        for (int e = 1; e <= 80; ++e)
+        {
+            p3 *= 3;
+            CAPTURE(e);
+            CHECK(slowmath::log_floori<int>(p3, uint128(3)) == e);
+            CHECK(slowmath::log_floori<int>(p3 - 1, uint128(3)) == e - 1);
+            CHECK(slowmath::log_ceili<int>(p3, uint128(3)) == e);
+            CHECK(slowmath::log_ceili<int>(p3 + 1, uint128(3)) == e + 1);
+        }
+        for (int k = 1; k != 128; ++k)
+        {
+            for (int j = 0; j != 128; ++j)
+            {
+                CAPTURE(k, j);
+                CHECK(slowmath::log_floori<int>(uint128(1) << j, uint128(1) << k) == j / k);
+                CHECK(slowmath::log_ceili<int>(uint128(1) << j, uint128(1) << k) == (j + k - 1) / k);
+                CHECK(slowmath::log_ceili<int>((uint128(1) << j) + 1, uint128(1) << k) == j / k + 1);
+            }
+        }
+        auto f = slowmath::factorize_floori<int>(u64 + 5, uint128(2));
+        CHECK(f.exponent1 == 64);
+        CHECK(f.remainder == 5);
+
+        CHECK_THROWS_AS(slowmath::add_checked(uMax, uint128(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::subtract_checked(uint128(0), uint128(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_checked(u64, u64), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_checked(u64 + 1, u64 - 1 + (u64 >> 1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::shift_left_checked(uint128(2), 127), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(uint128(2), 128), std::system_error);
+        CHECK(slowmath::multiply_saturating(u64, u64) == uMax);
+        CHECK(slowmath::multiply_saturating(u64 - 1, u64 + 1) == uMax);
+        CHECK(slowmath::powi_saturating(uint128(2), 128) == uMax);
+
+        CHECK(slowmath::muldiv_floori_checked(uMax, uMax, uMax) == uMax);
+        CHECK(slowmath::muldiv_floori_checked(uMax, uint128(3), uint128(4)) == uMax / 4 * 3 + 2);
+        CHECK(slowmath::muldiv_floori_checked(u64, u64, u64 + 1) == u64 - 1);
+        CHECK(slowmath::muldiv_ceili_checked(u64, u64, u64 + 1) == u64);
+        CHECK_THROWS_AS(slowmath::muldiv_floori_checked(uMax, uMax, uMax - 1), std::system_error);
+
+        CHECK(slowmath::multiply_extended(uMax, uMax) == slowmath::extended_product<uint128>{ uMax - 1, 1 });
+        CHECK(slowmath::multiply_extended(u64, u64) == slowmath::extended_product<uint128>{ 1, 0 });
+        CHECK(slowmath::add_with_carry(uMax, uMax, true) == slowmath::carry_result<uint128>{ uMax, true });
+        CHECK(slowmath::subtract_with_borrow(uint128(0), u64, false) == slowmath::carry_result<uint128>{ uint128(0) - u64, true });
+    }
+
+    SECTION("divide(), modulo(), divmod() with divider for random operands")
+    {
+        check_divider_with_random_operands<int128>(42, 2000);
+        check_divider_with_random_operands<uint128>(43, 2000);
+    }
+
+    SECTION("multiply_add(), multiply_subtract() check only the final result")
+    {
+            // The intermediate products overflow, but the final results are representable.
+        CHECK(slowmath::multiply_add_checked(int128(1) << 126, int128(2), int128(-1)) == iMax);
+        CHECK(slowmath::multiply_subtract_checked(int128(1) << 126, int128(2), int128(1)) == iMax);
+        CHECK(slowmath::multiply_add_checked(int128(1) << 126, int128(-2), int128(0)) == iMin);
+        CHECK(slowmath::multiply_add_checked(-(int128(1) << 126), int128(-2), int128(-1)) == iMax);
+        CHECK(slowmath::multiply_subtract_checked(u64, u64, uint128(1)) == uMax);
+        CHECK(slowmath::try_multiply_subtract(uMax / 3 + 1, uint128(3), uint128(3)).value == uMax);
+        static_assert(slowmath::multiply_subtract_checked(u64, u64, uint128(1)) == uMax, "");
+
+        CHECK_THROWS_AS(slowmath::multiply_add_checked(int128(1) << 126, int128(2), int128(0)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_subtract_checked(iMin, int128(1), int128(1)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_add_checked(u64, u64, uint128(0)), std::system_error);
+        CHECK_THROWS_AS(slowmath::multiply_subtract_checked(uint128(0), uMax, uint128(1)), std::system_error);
+        CHECK(slowmath::try_multiply_add(uMax, uMax, uMax).ec == std::errc::value_too_large);
+    }
+
+    SECTION("agrees with portable double-word arithmetic")
+    {
+        const int128 ivalues[] = {
+            0, 1, -1, 3, -5, (int128(1) << 63) - 1, int128(1) << 63, i64 - 1, i64, -i64, i64 + 1, 3 * (i64 >> 2),
+            iMax / 3, iMax / 2, -(iMax / 2) - 1, iMax, iMin, iMin + 1
+        };
+        for (int128 a : ivalues)
+        {
+            for (int128 b : ivalues)
+            {
+                auto p = slowmath::detail::widening_multiply_0<int128>(std::true_type{ }, a, b);
+                auto pr = slowmath::try_multiply(a, b);
+                CHECK((pr.ec == std::errc{ }) == fits<int128>(p));
+                if (pr.ec == std::errc{ }) CHECK(pr.value == truncate<int128>(p));
+
+                auto pw = slowmath::detail::multiply_wrapping_0(std::false_type{ }, a, b);
+                CHECK(pw.overflow == (pr.ec != std::errc{ }));
+                CHECK(pw.value == truncate<int128>(p));
+
+                auto s = slowmath::detail::widening_add_0<int128>(std::true_type{ }, a, b);
+                auto sr = slowmath::try_add(a, b);
+                CHECK((sr.ec == std::errc{ }) == fits<int128>(s));
+                if (sr.ec == std::errc{ }) CHECK(sr.value == truncate<int128>(s));
+            }
+        }
+
+        const uint128 uvalues[] = {
+            0, 1, 2, 3, (uint128(1) << 63) - 1, uint128(1) << 63, u64 - 1, u64, u64 + 1, 3 * (u64 >> 2),
+            uMax / 3, uMax / 2, uMax - 1, uMax
+        };
+        for (uint128 a : uvalues)
+        {
+            for (uint128 b : uvalues)
+            {
+                auto p = slowmath::detail::widening_multiply_0<uint128>(std::true_type{ }, a, b);
+                auto pr = slowmath::try_multiply(a, b);
+                CHECK((pr.ec == std::errc{ }) == fits<uint128>(p));
+                if (pr.ec == std::errc{ }) CHECK(pr.value == truncate<uint128>(p));
+
+                auto pw = slowmath::detail::multiply_wrapping_0(std::false_type{ }, a, b);
+                CHECK(pw.overflow == (pr.ec != std::errc{ }));
+                CHECK(pw.value == truncate<uint128>(p));
+            }
+        }
+    }
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+
+
+template <typename V>
+std::vector<V>
+make_batch_operands(std::size_t n, std::uint64_t seed, bool sparseEdgeValues)
+{
+    static constexpr V vMin = std::numeric_limits<V>::min();
+    static constexpr V vMax = std::numeric_limits<V>::max();
+    static constexpr V edgeValues[] = { V(vMax / 2), V(vMax / 2 + 1), V(vMax - 1), vMax, vMin, V(vMin + 1), V(vMin / 2) };
+
+        // Small values never overflow; the edge values cause overflow at scattered indices.
+    auto result = std::vector<V>(n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        auto r = unsigned(seed >> 33);
+        result[i] = sparseEdgeValues && r % 97 == 0
+            ? edgeValues[(r >> 8) % 7]
+            : V(int(r % 16) - (std::numeric_limits<V>::is_signed ? 8 : 0));
+    }
+    return result;
+}
+
+    // Compares the results of a batch operation with the results of the scalar operation.
+template <typename V, typename TryBatchF, typename TryScalarF>
+void
+check_batch(std::size_t n, TryBatchF tryBatch, TryScalarF tryScalar)
+{
+    static constexpr V unmodified = V(42);
+
+    std::size_t first = n;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        if (tryScalar(i).ec != std::errc{ })
+        {
+            first = i;
+            break;
+        }
+    }
+    auto dst = std::vector<V>(n, unmodified);
+    slowmath::arithmetic_result<std::size_t> r = tryBatch(gsl::span<V>(dst));
+    CHECK(r.value == first);
+    CHECK((r.ec == std::errc{ }) == (first == n));
+    std::size_t numMismatches = 0;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        numMismatches += (i < first ? dst[i] != tryScalar(i).value : dst[i] != unmodified);
+    }
+    CHECK(numMismatches == 0);
+}
+
+TEMPLATE_TEST_CASE("try_add(), add_checked() etc. for spans", "[arithmetic]", std::int8_t, std::uint8_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t)
+{
+    using V = TestType;
+
+    auto n = GENERATE(std::size_t(0), std::size_t(1), std::size_t(255), std::size_t(256), std::size_t(1000));
+    auto sparseEdgeValues = GENERATE(false, true);
+
+    CAPTURE(n, sparseEdgeValues);
+
+    auto a = make_batch_operands<V>(n, 1, sparseEdgeValues);
+    auto b = make_batch_operands<V>(n, 2, sparseEdgeValues);
+    auto x = std::vector<V>(n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        x[i] = a[i] < V(0) ? V(~a[i]) : a[i];
+    }
+    auto ca = gsl::span<V const>(a);
+    auto cb = gsl::span<V const>(b);
+    auto cx = gsl::span<V const>(x);
+
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_add(ca, cb, dst); }, [&](std::size_t i) { return slowmath::try_add(a[i], b[i]); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_subtract(ca, cb, dst); }, [&](std::size_t i) { return slowmath::try_subtract(a[i], b[i]); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_multiply(ca, cb, dst); }, [&](std::size_t i) { return slowmath::try_multiply(a[i], b[i]); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_negate(ca, dst); }, [&](std::size_t i) { return slowmath::try_negate(a[i]); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_absi(ca, dst); }, [&](std::size_t i) { return slowmath::try_absi(a[i]); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_shift_left(cx, 3, dst); }, [&](std::size_t i) { return slowmath::try_shift_left(x[i], 3); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_shift_left(cx, std::integral_constant<int, 3>{ }, dst); }, [&](std::size_t i) { return slowmath::try_shift_left(x[i], 3); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_shift_left(cx, sizeof(V) * 8, dst); }, [&](std::size_t i) { return slowmath::try_shift_left(x[i], sizeof(V) * 8); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_ceili(ca, V(3), dst); }, [&](std::size_t i) { return slowmath::try_ceili(a[i], V(3)); });
+    check_batch<V>(n, [&](gsl::span<V> dst) { return slowmath::try_ceili(ca, std::integral_constant<V, 8>{ }, dst); }, [&](std::size_t i) { return slowmath::try_ceili(a[i], V(8)); });
+
+    SECTION("destination may alias an argument")
+    {
+        auto dst = a;
+        auto r = slowmath::try_add(gsl::span<V const>(dst), cb, gsl::span<V>(dst));
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            auto ri = slowmath::try_add(a[i], b[i]);
+            if (ri.ec != std::errc{ })
+            {
+                CHECK(r.value == i);
+                CHECK(dst[i] == a[i]);
+                break;
+            }
+            CHECK(dst[i] == ri.value);
+        }
+    }
+
+    SECTION("checked and failfast variants")
+    {
+        auto dst = std::vector<V>(n);
+        if (!sparseEdgeValues)
+        {
+            slowmath::add_checked(ca, cb, gsl::span<V>(dst));
+            slowmath::add_failfast(ca, cb, gsl::span<V>(dst));
+            slowmath::multiply_checked(ca, cb, gsl::span<V>(dst));
+            slowmath::ceili_checked(ca, V(5), gsl::span<V>(dst));
+        }
+        else if (n >= 1000)
+        {
+            CHECK_THROWS_AS(slowmath::add_checked(ca, cb, gsl::span<V>(dst)), slowmath::overflow_error);
+            CHECK_THROWS_AS(slowmath::subtract_checked(ca, cb, gsl::span<V>(dst)), slowmath::overflow_error);
+            CHECK_THROWS_AS(slowmath::multiply_checked(ca, cb, gsl::span<V>(dst)), slowmath::overflow_error);
+        }
+    }
+
+    SECTION("enforces preconditions")
+    {
+        auto dst = std::vector<V>(n);
+        auto dst1 = std::vector<V>(n + 1);
+        CHECK_THROWS(slowmath::add_checked(ca, cb, gsl::span<V>(dst1)));
+        CHECK_THROWS(slowmath::negate_checked(ca, gsl::span<V>(dst1)));
+        CHECK_THROWS(slowmath::ceili_checked(ca, V(0), gsl::span<V>(dst)));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("sum(), product(), dot() for spans", "[arithmetic]", std::int8_t, std::uint8_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t)
+{
+    using V = TestType;
+
+    static constexpr V vMin = std::numeric_limits<V>::min();
+    static constexpr V vMax = std::numeric_limits<V>::max();
+    static constexpr bool isSigned = std::numeric_limits<V>::is_signed;
+
+    SECTION("empty spans")
+    {
+        auto empty = gsl::span<V const>{ };
+        CHECK(slowmath::sum_checked(empty) == V(0));
+        CHECK(slowmath::product_checked(empty) == V(1));
+        CHECK(slowmath::dot_checked(empty, empty) == V(0));
+    }
+
+    SECTION("intermediate results may overflow")
+    {
+        auto v = std::vector<V>{ vMax, vMax, V(1), V(vMax - 1), isSigned ? vMin : V(0), isSigned ? vMin : V(0) };
+        if (isSigned)
+        {
+                // vMax + vMax + 1 + (vMax - 1) + vMin + vMin = vMax - 2
+            CHECK(slowmath::sum_checked(gsl::span<V const>(v)) == V(vMax - 2));
+        }
+        else
+        {
+            CHECK_THROWS_AS(slowmath::sum_checked(gsl::span<V const>(v)), slowmath::overflow_error);
+            CHECK(slowmath::try_sum(gsl::span<V const>(v)).ec == std::errc::value_too_large);
+            CHECK(slowmath::sum_saturating(gsl::span<V const>(v)) == vMax);
+        }
+
+        auto w = std::vector<V>{ vMax, V(2), V(0) };
+        CHECK(slowmath::product_checked(gsl::span<V const>(w)) == V(0));
+        w.pop_back();
+        CHECK_THROWS_AS(slowmath::product_checked(gsl::span<V const>(w)), slowmath::overflow_error);
+        CHECK(slowmath::product_saturating(gsl::span<V const>(w)) == vMax);
+
+        auto a = std::vector<V>{ vMax, vMax, V(1) };
+        auto b = std::vector<V>{ vMax, V(1), V(1) };
+        CHECK_THROWS_AS(slowmath::dot_checked(gsl::span<V const>(a), gsl::span<V const>(b)), slowmath::overflow_error);
+        if (isSigned)
+        {
+                // vMax² - vMax² + 1 = 1
+            b[1] = V(-vMax);
+            CHECK(slowmath::dot_checked(gsl::span<V const>(a), gsl::span<V const>(b)) == V(1));
+        }
+    }
+
+    SECTION("boundaries of the result type")
+    {
+        auto v = std::vector<V>(70000, V(0));
+        v[0] = vMax;
+        CHECK(slowmath::sum_checked(gsl::span<V const>(v)) == vMax);
+        v[69999] = V(1);
+        CHECK(slowmath::try_sum(gsl::span<V const>(v)).ec == std::errc::value_too_large);
+        CHECK(slowmath::sum_saturating(gsl::span<V const>(v)) == vMax);
+        if (isSigned)
+        {
+            v[0] = vMin;
+            v[69999] = V(0);
+            CHECK(slowmath::sum_checked(gsl::span<V const>(v)) == vMin);
+            v[69999] = V(-1);
+            CHECK(slowmath::try_sum(gsl::span<V const>(v)).ec == std::errc::value_too_large);
+            CHECK(slowmath::sum_saturating(gsl::span<V const>(v)) == vMin);
+
+            auto w = std::vector<V>{ V(vMin / 2), V(2) };
+            CHECK(slowmath::product_checked(gsl::span<V const>(w)) == vMin);
+            w[0] = V(-(vMin / 2));
+            CHECK_THROWS_AS(slowmath::product_checked(gsl::span<V const>(w)), slowmath::overflow_error);
+            w = { V(-1), V(-1), V(-1), V(-1), V(-1), V(vMax) };
+            CHECK(slowmath::product_checked(gsl::span<V const>(w)) == V(-vMax));
+            w.push_back(V(-2));
+            CHECK(slowmath::product_saturating(gsl::span<V const>(w)) == vMax);
+            w.push_back(V(-1));
+            CHECK(slowmath::product_saturating(gsl::span<V const>(w)) == vMin);
+
+            auto a = std::vector<V>(70000, vMax);
+            auto b = std::vector<V>(70000);
+            for (std::size_t i = 0; i != b.size(); ++i)
+            {
+                b[i] = i % 2 == 0 ? vMax : V(-vMax);
+            }
+            CHECK(slowmath::dot_checked(gsl::span<V const>(a), gsl::span<V const>(b)) == V(0));
+            a[69998] = V(vMin / 2);
+            b[69998] = V(2);
+            a[69999] = V(0);
+            CHECK(slowmath::dot_checked(gsl::span<V const>(a), gsl::span<V const>(b)) == vMin);
+            a[69999] = V(1);
+            b[69999] = V(-1);
+            CHECK(slowmath::try_dot(gsl::span<V const>(a), gsl::span<V const>(b)).ec == std::errc::value_too_large);
+            CHECK(slowmath::dot_saturating(gsl::span<V const>(a), gsl::span<V const>(b)) == vMin);
+        }
+    }
+
+    SECTION("preconditions")
+    {
+        auto a = std::vector<V>(3);
+        auto b = std::vector<V>(4);
+        CHECK_THROWS(slowmath::dot_checked(gsl::span<V const>(a), gsl::span<V const>(b)));
+    }
+
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+    SECTION("comparison with 128-bit arithmetic")
+    {
+        using slowmath::detail::int128;
+
+        auto n = GENERATE(std::size_t(1), std::size_t(1000), std::size_t(70000));
+        auto sparseEdgeValues = GENERATE(false, true);
+
+        CAPTURE(n, sparseEdgeValues);
+
+        auto a = make_batch_operands<V>(n, 1, sparseEdgeValues);
+        auto b = make_batch_operands<V>(n, 2, sparseEdgeValues);
+        int128 refSum = 0;
+        int128 refDot = 0;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            refSum += int128(a[i]);
+            refDot += sizeof(V) <= 4 ? int128(a[i]) * int128(b[i]) : 0;
+        }
+        auto sum = slowmath::try_sum(gsl::span<V const>(a));
+        auto dot = slowmath::try_dot(gsl::span<V const>(a), gsl::span<V const>(b));
+        CHECK((sum.ec == std::errc{ }) == (refSum >= int128(vMin) && refSum <= int128(vMax)));
+        if (sum.ec == std::errc{ }) CHECK(sum.value == V(refSum));
+        if (sizeof(V) <= 4)  // otherwise the reference result might overflow
+        {
+            CHECK((dot.ec == std::errc{ }) == (refDot >= int128(vMin) && refDot <= int128(vMax)));
+            if (dot.ec == std::errc{ }) CHECK(dot.value == V(refDot));
+        }
+    }
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
+}
+
+
+    // Computes the running sums of an exclusive or inclusive scan with scalar operations; returns the index of the first sum
+    // which is not representable.
+template <typename R, typename V>
+std::size_t
+scan_scalar(std::vector<V> const& src, std::vector<R>& dst, bool inclusive, R init)
+{
+    std::size_t n = src.size();
+    R sum = init;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        if (!inclusive) dst[i] = sum;
+        if (!inclusive && i + 1 == n) break;
+        auto r = slowmath::try_add(sum, R(src[i]));
+        if (r.ec != std::errc{ }) return inclusive ? i : i + 1;
+        sum = r.value;
+        if (inclusive) dst[i] = sum;
+    }
+    return n;
+}
+
+TEMPLATE_TEST_CASE("try_exclusive_scan(), inclusive_scan_checked() etc.", "[arithmetic]", std::int8_t, std::uint8_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t)
+{
+    using V = TestType;
+
+    static constexpr V unmodified = V(42);
+
+    auto n = GENERATE(std::size_t(0), std::size_t(1), std::size_t(255), std::size_t(256), std::size_t(257), std::size_t(1000));
+    auto sparseEdgeValues = GENERATE(false, true);
+    auto inclusive = GENERATE(false, true);
+
+    CAPTURE(n, sparseEdgeValues, inclusive);
+
+    auto src = make_batch_operands<V>(n, 1, sparseEdgeValues);
+    auto init = V(n % 2 == 0 ? 0 : 3);
+    auto expected = std::vector<V>(n, unmodified);
+    std::size_t first = scan_scalar(src, expected, inclusive, inclusive ? V(0) : init);
+
+    auto dst = std::vector<V>(n, unmodified);
+    auto r = inclusive
+        ? slowmath::try_inclusive_scan(gsl::span<V const>(src), gsl::span<V>(dst))
+        : slowmath::try_exclusive_scan(gsl::span<V const>(src), gsl::span<V>(dst), init);
+    CHECK(r.value == first);
+    CHECK((r.ec == std::errc{ }) == (first == n));
+    CHECK(dst == expected);
+
+    SECTION("destination may alias the source")
+    {
+        auto inPlace = src;
+        for (std::size_t i = first; i != n; ++i)
+        {
+            expected[i] = src[i];
+        }
+        auto r2 = inclusive
+            ? slowmath::try_inclusive_scan(gsl::span<V const>(inPlace), gsl::span<V>(inPlace))
+            : slowmath::try_exclusive_scan(gsl::span<V const>(inPlace), gsl::span<V>(inPlace), init);
+        CHECK(r2.value == first);
+        CHECK(inPlace == expected);
+    }
+
+    SECTION("checked and failfast variants")
+    {
+        if (first == n)
+        {
+            if (inclusive)
+            {
+                slowmath::inclusive_scan_checked(gsl::span<V const>(src), gsl::span<V>(dst));
+                slowmath::inclusive_scan_failfast(gsl::span<V const>(src), gsl::span<V>(dst));
+            }
+            else
+            {
+                slowmath::exclusive_scan_checked(gsl::span<V const>(src), gsl::span<V>(dst), init);
+                slowmath::exclusive_scan_failfast(gsl::span<V const>(src), gsl::span<V>(dst), init);
+            }
+            CHECK(dst == expected);
+        }
+        else if (inclusive)
+        {
+            CHECK_THROWS_AS(slowmath::inclusive_scan_checked(gsl::span<V const>(src), gsl::span<V>(dst)), slowmath::overflow_error);
+        }
+        else
+        {
+            CHECK_THROWS_AS(slowmath::exclusive_scan_checked(gsl::span<V const>(src), gsl::span<V>(dst), init), slowmath::overflow_error);
+        }
+    }
+}
+
+TEST_CASE("exclusive_scan_checked(), inclusive_scan_checked() for offset tables", "[arithmetic]")
+{
+    static constexpr std::uint32_t u32Max = std::numeric_limits<std::uint32_t>::max();
+
+    auto counts = std::vector<std::uint32_t>{ 3, u32Max, 2, u32Max };
+    auto offsets32 = std::vector<std::uint32_t>(counts.size());
+    auto offsets64 = std::vector<std::uint64_t>(counts.size() + 1);
+
+    auto r = slowmath::try_exclusive_scan(gsl::span<std::uint32_t const>(counts), gsl::span<std::uint32_t>(offsets32));
+    CHECK(r.ec == std::errc::value_too_large);
+    CHECK(r.value == 2);
+    CHECK(offsets32[0] == 0);
+    CHECK(offsets32[1] == 3);
+
+        // The sum of all elements is not computed by an exclusive scan.
+    counts[1] = 0;
+    slowmath::exclusive_scan_checked(gsl::span<std::uint32_t const>(counts), gsl::span<std::uint32_t>(offsets32));
+    CHECK(offsets32 == std::vector<std::uint32_t>{ 0, 3, 3, 5 });
+    CHECK_THROWS_AS(slowmath::inclusive_scan_checked(gsl::span<std::uint32_t const>(counts), gsl::span<std::uint32_t>(offsets32)), slowmath::overflow_error);
+
+        // The elements may be widened to the destination type.
+    counts[1] = u32Max;
+    offsets64[0] = 0;
+    slowmath::inclusive_scan_checked(gsl::span<std::uint32_t const>(counts), gsl::span<std::uint64_t>(offsets64.data() + 1, counts.size()));
+    CHECK(offsets64 == std::vector<std::uint64_t>{ 0, 3, 3 + std::uint64_t(u32Max), 5 + std::uint64_t(u32Max), 5 + 2 * std::uint64_t(u32Max) });
+
+    auto values = std::vector<std::uint32_t>(3);
+    CHECK_THROWS(slowmath::inclusive_scan_checked(gsl::span<std::uint32_t const>(counts), gsl::span<std::uint32_t>(values)));
+}
+
+
 // TODO: add comprehensive tests for divide()
 // TODO: add comprehensive tests for modulo()
@@ -1,5 +1,6 @@
 
 #include <tuple>
+#include <type_traits>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -7,4 +8,35 @@
 
 
 // TODO: add comprehensive tests for shift_left()
+TEST_CASE("shift_left() with constant shift", "[bits]")
+{
+    using Shift0 = std::integral_constant<int, 0>;
+    using Shift4 = std::integral_constant<int, 4>;
+    using Shift31 = std::integral_constant<int, 31>;
+    using Shift32 = std::integral_constant<int, 32>;
+
+    CHECK(slowmath::shift_left_checked(1u, Shift0{ }) == 1u);
+    CHECK(slowmath::shift_left_checked(0x0FFF'FFFFu, Shift4{ }) == 0xFFFF'FFF0u);
+    CHECK(slowmath::shift_left_checked(1u, Shift31{ }) == 0x8000'0000u);
+    CHECK(slowmath::shift_left_checked(1, Shift4{ }) == 16);
+    CHECK_THROWS_AS(slowmath::shift_left_checked(0x1000'0000u, Shift4{ }), std::system_error);
+    CHECK_THROWS_AS(slowmath::shift_left_checked(1, Shift31{ }), std::system_error);
+    CHECK_THROWS_AS(slowmath::shift_left_checked(1u, Shift32{ }), std::system_error);
+    CHECK(slowmath::try_shift_left(0u, Shift32{ }).ec == std::errc::value_too_large);
+    static_assert(slowmath::shift_left_checked(3u, Shift4{ }) == 48u, "");
+}
+
+TEST_CASE("shift_left_saturating()", "[bits]")
+{
+    using Shift4 = std::integral_constant<int, 4>;
+
+    CHECK(slowmath::shift_left_saturating(1u, 31) == 0x8000'0000u);
+    CHECK(slowmath::shift_left_saturating(3u, 31) == 0xFFFF'FFFFu);
+    CHECK(slowmath::shift_left_saturating(1u, 32) == 0xFFFF'FFFFu);
+    CHECK(slowmath::shift_left_saturating(1, 30) == 0x4000'0000);
+    CHECK(slowmath::shift_left_saturating(1, 31) == 0x7FFF'FFFF);
+    CHECK(slowmath::shift_left_saturating(0x1000'0000u, Shift4{ }) == 0xFFFF'FFFFu);
+    static_assert(slowmath::shift_left_saturating(std::uint8_t(0x81), 1) == 0xFF, "");
+}
+
 // TODO: add comprehensive tests for shift_right()
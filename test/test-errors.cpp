@@ -0,0 +1,197 @@
+
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <system_error>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <slowmath/arithmetic.hpp>
+
+
+namespace {
+
+
+template <typename T>
+struct maybe
+{
+    T value;
+    bool valid;
+};
+
+struct invalid_wildcard
+{
+    template <typename T>
+    constexpr operator maybe<T>(void) const noexcept
+    {
+        return { T{ }, false };
+    }
+};
+
+    // Custom error handler which implements the error handler protocol.
+struct maybe_error_handler
+{
+    template <typename T> using result = maybe<T>;
+
+    template <typename T>
+    static constexpr maybe<T>
+    make_result(T value) noexcept
+    {
+        return { value, true };
+    }
+    static constexpr bool
+    check(bool condition) noexcept
+    {
+        return condition;
+    }
+    static constexpr invalid_wildcard
+    make_error(std::errc) noexcept
+    {
+        return { };
+    }
+    static constexpr invalid_wildcard
+    make_overflow_error(bool /*negative*/) noexcept
+    {
+        return { };
+    }
+    template <typename T>
+    static constexpr T
+    get_value(maybe<T> const& result) noexcept
+    {
+        return result.value;
+    }
+    template <typename T>
+    static constexpr bool
+    is_error(maybe<T> const& result) noexcept
+    {
+        return !result.valid;
+    }
+    template <typename T>
+    static constexpr invalid_wildcard
+    passthrough_error(maybe<T> const&) noexcept
+    {
+        return { };
+    }
+};
+
+
+} // anonymous namespace
+
+
+TEST_CASE("generic operations with predefined error handlers", "[errors]")
+{
+    static constexpr auto iMax = std::numeric_limits<std::int32_t>::max();
+
+    static_assert(std::is_same<slowmath::default_error_handler, slowmath::ignore_error_handler>::value, "");
+
+    CHECK(slowmath::add(std::int32_t(1), std::int32_t(2)) == 3);
+    CHECK(slowmath::negate(std::int32_t(1)) == -1);
+    CHECK(slowmath::multiply<slowmath::throw_error_handler>(std::int32_t(3), std::int32_t(4)) == 12);
+    CHECK(slowmath::subtract<slowmath::trap_error_handler>(std::int32_t(3), std::int32_t(4)) == -1);
+    CHECK(slowmath::narrow<std::int8_t, slowmath::trap_error_handler>(-128) == -128);
+    CHECK(slowmath::absi<slowmath::trap_error_handler>(-iMax) == iMax);
+    CHECK(slowmath::powi<slowmath::trap_error_handler>(std::int32_t(3), 3) == 27);
+
+    CHECK_THROWS_AS(slowmath::add<slowmath::throw_error_handler>(iMax, std::int32_t(1)), std::system_error);
+    CHECK_THROWS_AS(slowmath::negate<slowmath::throw_error_handler>(std::uint32_t(1)), std::system_error);
+    CHECK_THROWS_AS(slowmath::ceili<slowmath::throw_error_handler>(iMax, std::int32_t(2)), std::system_error);
+    CHECK_THROWS_AS((slowmath::narrow<std::uint8_t, slowmath::throw_error_handler>(256)), std::system_error);
+    CHECK_THROWS(slowmath::multiply<slowmath::failfast_error_handler>(iMax, std::int32_t(2)));
+    CHECK(slowmath::square<slowmath::assume_error_handler>(std::int32_t(-46340)) == 2147395600);
+#ifndef NDEBUG
+    CHECK_THROWS(slowmath::square<slowmath::assume_error_handler>(iMax));
+    CHECK_THROWS(slowmath::add<slowmath::assume_error_handler>(iMax, std::int32_t(1)));
+#endif // NDEBUG
+
+    auto r = slowmath::add<slowmath::try_error_handler>(iMax, std::int32_t(1));
+    static_assert(std::is_same<decltype(r), slowmath::arithmetic_result<std::int32_t>>::value, "");
+    CHECK(r.ec == std::errc::value_too_large);
+    CHECK(slowmath::add_to<std::int64_t, slowmath::try_error_handler>(iMax, std::int32_t(1)).value == std::int64_t(iMax) + 1);
+    CHECK(slowmath::divide<slowmath::try_error_handler>(std::numeric_limits<std::int32_t>::min(), std::int32_t(-1)).ec == std::errc::value_too_large);
+
+    auto c = slowmath::multiply<slowmath::trap_error_handler>(std::integral_constant<int, 6>{ }, std::integral_constant<int, 7>{ });
+    static_assert(std::is_same<decltype(c), std::integral_constant<int, 42>>::value, "");
+    static_assert(slowmath::add<slowmath::trap_error_handler>(iMax - 1, std::int32_t(1)) == iMax, "");
+}
+
+TEST_CASE("generic operations with custom error handler", "[errors]")
+{
+    static constexpr auto iMin = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+
+    auto r1 = slowmath::add<maybe_error_handler>(iMax - 1, std::int64_t(1));
+    CHECK(r1.valid);
+    CHECK(r1.value == iMax);
+    CHECK_FALSE(slowmath::add<maybe_error_handler>(iMax, std::int64_t(1)).valid);
+    CHECK_FALSE(slowmath::multiply_add<maybe_error_handler>(iMax, std::int64_t(2), std::int64_t(2)).valid);
+    CHECK(slowmath::multiply_add<maybe_error_handler>(iMax, std::int64_t(2), iMin).value == iMax - 1);
+    CHECK(slowmath::multiply_add<maybe_error_handler>(std::int64_t(3), std::int64_t(4), std::int64_t(5)).value == 17);
+    CHECK_FALSE(slowmath::multiply_to<std::int64_t, maybe_error_handler>(std::uint64_t(iMax), std::int64_t(-2)).valid);
+    CHECK(slowmath::multiply_to<std::int64_t, maybe_error_handler>(std::uint64_t(iMax), std::int64_t(-1)).value == -iMax);
+    CHECK_FALSE(slowmath::ratio_floori<maybe_error_handler>(iMin, std::int64_t(-1)).valid);
+    CHECK_FALSE(slowmath::narrow<std::int32_t, maybe_error_handler>(iMax).valid);
+
+    static_assert(slowmath::powi<maybe_error_handler>(std::int64_t(2), 62).valid, "");
+    static_assert(!slowmath::powi<maybe_error_handler>(std::int64_t(2), 63).valid, "");
+}
+
+TEST_CASE("overflow_error", "[errors]")
+{
+    static constexpr auto iMax = std::numeric_limits<std::int32_t>::max();
+
+    SECTION("records the operation")
+    {
+        try
+        {
+            (void) slowmath::multiply_checked(iMax, std::int32_t(2));
+            FAIL("no exception thrown");
+        }
+        catch (slowmath::overflow_error const& e)
+        {
+            CHECK(e.operation() == slowmath::arithmetic_operation::multiply);
+            CHECK(std::strcmp(e.what(), "integer overflow in multiply()") == 0);
+        }
+
+        try
+        {
+            (void) slowmath::powi_checked(iMax, 2);
+            FAIL("no exception thrown");
+        }
+        catch (slowmath::overflow_error const& e)
+        {
+            CHECK(e.operation() == slowmath::arithmetic_operation::powi);
+        }
+    }
+
+    SECTION("is a std::system_error")
+    {
+        try
+        {
+            (void) slowmath::narrow_checked<std::uint8_t>(-1);
+            FAIL("no exception thrown");
+        }
+        catch (std::system_error const& e)
+        {
+            CHECK(e.code() == std::errc::value_too_large);
+        }
+    }
+
+    SECTION("operation is unspecified for throw_error_handler and overflow_accumulator")
+    {
+        try
+        {
+            (void) slowmath::add<slowmath::throw_error_handler>(iMax, std::int32_t(1));
+            FAIL("no exception thrown");
+        }
+        catch (slowmath::overflow_error const& e)
+        {
+            CHECK(e.operation() == slowmath::arithmetic_operation::unspecified);
+            CHECK(std::strcmp(e.what(), "integer overflow") == 0);
+        }
+
+        auto acc = slowmath::overflow_accumulator{ };
+        (void) acc.add(iMax, std::int32_t(1));
+        CHECK_THROWS_AS(acc.check(), slowmath::overflow_error);
+    }
+}
@@ -1,5 +1,6 @@
 
 #include <tuple>
+#include <type_traits>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -10,3 +11,37 @@
 TEST_CASE("gcd() and lcm()")
 {
 }
+
+TEST_CASE("gcd() and lcm() of std::integral_constant<> arguments yield std::integral_constant<> results", "[gcd][lcm]")
+{
+    using C12 = std::integral_constant<int, 12>;
+    using C18 = std::integral_constant<int, -18>;
+
+    static_assert(std::is_same<decltype(slowmath::gcd_checked(C12{ }, C18{ })), std::integral_constant<int, 6>>::value);
+    static_assert(std::is_same<decltype(slowmath::lcm_checked(C12{ }, C18{ })), std::integral_constant<int, -36>>::value);
+    static_assert(std::is_same<decltype(slowmath::lcm_checked(C12{ }, 18)), int>::value);
+}
+
+#if defined(SLOWMATH_DETAIL_HAVE_INT128)
+TEST_CASE("gcd() and lcm() with 128-bit operands", "[gcd][lcm]")
+{
+    using slowmath::detail::int128;
+    using slowmath::detail::uint128;
+
+    static constexpr int128 iMin = slowmath::detail::min_v<int128>;
+    static constexpr int128 i64 = int128(1) << 64;
+    static constexpr uint128 u64 = uint128(1) << 64;
+
+    CHECK(slowmath::gcd_checked(int128(0), int128(0)) == 0);
+    CHECK(slowmath::gcd_checked(int128(0), -i64) == i64);
+    CHECK(slowmath::gcd_checked(3 * i64, -12 * i64) == 3 * i64);
+    CHECK(slowmath::gcd_checked(u64 * 35, u64 * 21) == u64 * 7);
+    CHECK(slowmath::gcd_checked(u64 + 1, u64 - 1) == 1);
+    CHECK(slowmath::lcm_checked(int128(-6), i64) == -3 * i64);
+    CHECK(slowmath::lcm_checked(u64, u64 >> 1) == u64);
+    CHECK(slowmath::lcm_checked(uint128(0), u64) == 0);
+
+    CHECK_THROWS_AS(slowmath::gcd_checked(iMin, int128(2)), std::system_error);
+    CHECK_THROWS_AS(slowmath::lcm_checked(i64 + 1, i64 - 1), std::system_error);
+}
+#endif // defined(SLOWMATH_DETAIL_HAVE_INT128)
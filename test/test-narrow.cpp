@@ -0,0 +1,152 @@
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <type_traits>
+#include <system_error>
+
+#include <gsl-lite/gsl-lite.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <slowmath/arithmetic.hpp>
+
+
+TEMPLATE_TEST_CASE("narrow_checked(), try_narrow(), narrow_saturating()", "[narrow]", std::int8_t, std::uint8_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t)
+{
+    using R = TestType;
+
+    static constexpr auto rMin = std::numeric_limits<R>::min();
+    static constexpr auto rMax = std::numeric_limits<R>::max();
+    static constexpr auto iMin = std::numeric_limits<std::int64_t>::min();
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+
+    SECTION("signed argument")
+    {
+        auto v = GENERATE(iMin, iMin + 1, std::int64_t(-2147483649), std::int64_t(-2147483648), std::int64_t(-129), std::int64_t(-128), std::int64_t(-1), std::int64_t(0),
+            std::int64_t(127), std::int64_t(128), std::int64_t(255), std::int64_t(256), std::int64_t(2147483647), std::int64_t(2147483648), std::int64_t(4294967295), std::int64_t(4294967296), iMax);
+
+        CAPTURE(v);
+
+        bool representable = slowmath::cmp_greater_equal(v, rMin) && slowmath::cmp_less_equal(v, rMax);
+        auto r = slowmath::try_narrow<R>(v);
+        CHECK((r.ec == std::errc{ }) == representable);
+        if (representable)
+        {
+            CHECK(slowmath::cmp_equal(r.value, v));
+            CHECK(slowmath::narrow_checked<R>(v) == r.value);
+            CHECK(slowmath::narrow_failfast<R>(v) == r.value);
+            CHECK(slowmath::narrow_saturating<R>(v) == r.value);
+        }
+        else
+        {
+            CHECK(r.ec == std::errc::value_too_large);
+            CHECK_THROWS_AS(slowmath::narrow_checked<R>(v), std::system_error);
+            CHECK(slowmath::narrow_saturating<R>(v) == (v < 0 ? rMin : rMax));
+        }
+    }
+
+    SECTION("unsigned argument")
+    {
+        auto v = GENERATE(std::uint64_t(0), std::uint64_t(127), std::uint64_t(128), std::uint64_t(255), std::uint64_t(256), std::uint64_t(2147483647),
+            std::uint64_t(2147483648), std::uint64_t(4294967295), std::uint64_t(4294967296), std::uint64_t(iMax), std::uint64_t(iMax) + 1, uMax);
+
+        CAPTURE(v);
+
+        bool representable = slowmath::cmp_less_equal(v, rMax);
+        auto r = slowmath::try_narrow<R>(v);
+        CHECK((r.ec == std::errc{ }) == representable);
+        if (representable)
+        {
+            CHECK(slowmath::cmp_equal(r.value, v));
+            CHECK(slowmath::narrow_checked<R>(v) == r.value);
+        }
+        else
+        {
+            CHECK_THROWS_AS(slowmath::narrow_checked<R>(v), std::system_error);
+            CHECK(slowmath::narrow_saturating<R>(v) == rMax);
+        }
+    }
+}
+
+TEST_CASE("narrow_checked() with constant argument", "[narrow]")
+{
+    auto r = slowmath::narrow_checked<std::int8_t>(std::integral_constant<int, -100>{ });
+    static_assert(std::is_same<decltype(r), std::integral_constant<std::int8_t, -100>>::value, "");
+
+    static_assert(slowmath::narrow_checked<std::uint16_t>(65535) == 65535u, "");
+    static_assert(slowmath::try_narrow<std::uint16_t>(-1).ec == std::errc::value_too_large, "");
+    static_assert(slowmath::narrow_saturating<std::int16_t>(-65536) == -32768, "");
+}
+
+TEST_CASE("narrow_checked(), try_narrow() for spans", "[narrow]")
+{
+    auto n = GENERATE(std::size_t(0), std::size_t(1), std::size_t(255), std::size_t(256), std::size_t(1000));
+
+    CAPTURE(n);
+
+    auto src = std::vector<std::int64_t>(n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        src[i] = std::int64_t(i % 2 == 0 ? i : -std::int64_t(i));
+    }
+    auto dst = std::vector<std::int16_t>(n);
+
+    SECTION("all elements representable")
+    {
+        auto r = slowmath::try_narrow(gsl::span<std::int64_t const>(src), gsl::span<std::int16_t>(dst));
+        CHECK(r.ec == std::errc{ });
+        CHECK(r.value == n);
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            CHECK(dst[i] == src[i]);
+        }
+        slowmath::narrow_checked(gsl::span<std::int64_t>(src), gsl::span<std::int16_t>(dst));
+        slowmath::narrow_failfast(gsl::span<std::int64_t>(src), gsl::span<std::int16_t>(dst));
+    }
+
+    SECTION("reports first offending element")
+    {
+        if (n == 0) return;
+
+        std::size_t first = n * 2 / 3;
+        src[first] = -32769;
+        src[n - 1] = 32768;
+        auto r = slowmath::try_narrow(gsl::span<std::int64_t const>(src), gsl::span<std::int16_t>(dst));
+        CHECK(r.ec == std::errc::value_too_large);
+        CHECK(r.value == first);
+        for (std::size_t i = 0; i != first; ++i)
+        {
+            CHECK(dst[i] == src[i]);
+        }
+        CHECK_THROWS_AS(slowmath::narrow_checked(gsl::span<std::int64_t>(src), gsl::span<std::int16_t>(dst)), std::system_error);
+    }
+
+    SECTION("enforces preconditions")
+    {
+        auto dst1 = std::vector<std::int16_t>(n + 1);
+        CHECK_THROWS(slowmath::narrow_checked(gsl::span<std::int64_t>(src), gsl::span<std::int16_t>(dst1)));
+    }
+}
+
+TEST_CASE("try_narrow() for spans of different signedness", "[narrow]")
+{
+    auto src = std::vector<std::uint32_t>{ 0, 1, 0x7FFF'FFFFu, 0x8000'0000u, 2 };
+    auto dst = std::vector<std::int32_t>(src.size());
+    auto r = slowmath::try_narrow(gsl::span<std::uint32_t>(src), gsl::span<std::int32_t>(dst));
+    CHECK(r.ec == std::errc::value_too_large);
+    CHECK(r.value == 3);
+
+    auto src2 = std::vector<std::int8_t>{ 0, 1, -1 };
+    auto dst2 = std::vector<std::uint64_t>(src2.size());
+    auto r2 = slowmath::try_narrow(gsl::span<std::int8_t>(src2), gsl::span<std::uint64_t>(dst2));
+    CHECK(r2.value == 2);
+
+    auto dst3 = std::vector<std::int64_t>(src2.size());
+    auto r3 = slowmath::try_narrow(gsl::span<std::int8_t>(src2), gsl::span<std::int64_t>(dst3));
+    CHECK(r3.ec == std::errc{ });
+    CHECK(dst3[2] == -1);
+}
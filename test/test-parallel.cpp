@@ -0,0 +1,162 @@
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <gsl-lite/gsl-lite.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <slowmath/parallel.hpp>
+
+
+namespace {
+
+
+template <typename V>
+std::vector<V>
+make_operands(std::size_t n, std::uint64_t seed, std::size_t edgeValueIndex)
+{
+    static constexpr V vMin = std::numeric_limits<V>::min();
+    static constexpr V vMax = std::numeric_limits<V>::max();
+
+        // Small values never overflow in element-wise operations; a pair of edge values causes overflow at the given index.
+    auto result = std::vector<V>(n);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        result[i] = V(int((seed >> 33) % 16) - (std::numeric_limits<V>::is_signed ? 8 : 0));
+    }
+    if (edgeValueIndex < n)
+    {
+        result[edgeValueIndex] = seed % 2 == 0 ? vMax : vMin;
+        if (edgeValueIndex + 1 < n) result[edgeValueIndex + 1] = vMax;
+    }
+    return result;
+}
+
+    // Compares the results of a parallel batch operation with the results of the sequential batch operation. The elements of
+    // the destination span from the offending index on have unspecified values.
+template <typename V, typename TryParallelF, typename TrySequentialF>
+void
+check_parallel(std::size_t n, TryParallelF tryParallel, TrySequentialF trySequential)
+{
+    auto expected = std::vector<V>(n);
+    auto actual = std::vector<V>(n);
+    slowmath::arithmetic_result<std::size_t> re = trySequential(gsl::span<V>(expected));
+    slowmath::arithmetic_result<std::size_t> ra = tryParallel(gsl::span<V>(actual));
+    CHECK(ra.value == re.value);
+    CHECK(ra.ec == re.ec);
+    std::size_t numMismatches = 0;
+    for (std::size_t i = 0; i != re.value; ++i)
+    {
+        numMismatches += actual[i] != expected[i];
+    }
+    CHECK(numMismatches == 0);
+}
+
+
+} // anonymous namespace
+
+
+TEMPLATE_TEST_CASE("parallel overloads report the same results as sequential overloads", "[parallel]", std::int8_t, std::uint8_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t)
+{
+    using V = TestType;
+
+    auto numThreads = GENERATE(1u, 2u, 3u, 8u);
+    auto n = GENERATE(std::size_t(0), std::size_t(5), std::size_t(1000));
+    auto edgeValueIndex = GENERATE(std::size_t(0), std::size_t(400), std::size_t(999), std::size_t(1000));
+    auto policy = slowmath::parallel_policy{ numThreads, 16 };
+
+    CAPTURE(numThreads, n, edgeValueIndex);
+
+    auto a = make_operands<V>(n, 1, edgeValueIndex);
+    auto b = make_operands<V>(n, 2, edgeValueIndex);
+    auto ca = gsl::span<V const>(a);
+    auto cb = gsl::span<V const>(b);
+
+    SECTION("element-wise operations")
+    {
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_add(policy, ca, cb, dst); }, [&](gsl::span<V> dst) { return slowmath::try_add(ca, cb, dst); });
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_subtract(policy, ca, cb, dst); }, [&](gsl::span<V> dst) { return slowmath::try_subtract(ca, cb, dst); });
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_multiply(policy, ca, cb, dst); }, [&](gsl::span<V> dst) { return slowmath::try_multiply(ca, cb, dst); });
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_negate(policy, ca, dst); }, [&](gsl::span<V> dst) { return slowmath::try_negate(ca, dst); });
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_absi(policy, ca, dst); }, [&](gsl::span<V> dst) { return slowmath::try_absi(ca, dst); });
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_ceili(policy, ca, V(3), dst); }, [&](gsl::span<V> dst) { return slowmath::try_ceili(ca, V(3), dst); });
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_inclusive_scan(policy, ca, dst); }, [&](gsl::span<V> dst) { return slowmath::try_inclusive_scan(ca, dst); });
+        check_parallel<V>(n, [&](gsl::span<V> dst) { return slowmath::try_exclusive_scan(policy, ca, dst, V(1)); }, [&](gsl::span<V> dst) { return slowmath::try_exclusive_scan(ca, dst, V(1)); });
+
+        auto narrowed = std::vector<std::int8_t>(n);
+        auto rs = slowmath::try_narrow(ca, gsl::span<std::int8_t>(narrowed));
+        auto rp = slowmath::try_narrow(policy, ca, gsl::span<std::int8_t>(narrowed));
+        CHECK(rp.value == rs.value);
+        CHECK(rp.ec == rs.ec);
+    }
+
+    SECTION("reductions")
+    {
+        auto ss = slowmath::try_sum(ca);
+        auto sp = slowmath::try_sum(policy, ca);
+        CHECK(sp.ec == ss.ec);
+        CHECK(sp.value == ss.value);
+        CHECK(slowmath::sum_saturating(policy, ca) == slowmath::sum_saturating(ca));
+
+        auto ds = slowmath::try_dot(ca, cb);
+        auto dp = slowmath::try_dot(policy, ca, cb);
+        CHECK(dp.ec == ds.ec);
+        CHECK(dp.value == ds.value);
+
+        auto ps = slowmath::try_product(ca);
+        auto pp = slowmath::try_product(policy, ca);
+        CHECK(pp.ec == ps.ec);
+        CHECK(pp.value == ps.value);
+        CHECK(slowmath::product_saturating(policy, ca) == slowmath::product_saturating(ca));
+    }
+
+    SECTION("checked variants")
+    {
+        auto dst = std::vector<V>(n);
+        if (slowmath::try_add(ca, cb, gsl::span<V>(dst)).ec == std::errc{ })
+        {
+            slowmath::add_checked(policy, ca, cb, gsl::span<V>(dst));
+            slowmath::add_failfast(policy, ca, cb, gsl::span<V>(dst));
+        }
+        else
+        {
+            CHECK_THROWS_AS(slowmath::add_checked(policy, ca, cb, gsl::span<V>(dst)), std::system_error);
+        }
+    }
+}
+
+TEST_CASE("parallel scans check the running sums at the chunk boundaries", "[parallel]")
+{
+    static constexpr std::int32_t iMax = std::numeric_limits<std::int32_t>::max();
+
+    auto numThreads = GENERATE(2u, 3u, 4u);
+    auto policy = slowmath::parallel_policy{ numThreads, 1 };
+
+    CAPTURE(numThreads);
+
+        // The running sum overflows at index 3 and returns to the representable range at index 4.
+    auto src = std::vector<std::int32_t>{ 1, iMax - 2, 1, 1, -10, 1, 1, 1 };
+    auto dst = std::vector<std::int32_t>(src.size());
+    auto r = slowmath::try_inclusive_scan(policy, gsl::span<std::int32_t const>(src), gsl::span<std::int32_t>(dst));
+    CHECK(r.ec == std::errc::value_too_large);
+    CHECK(r.value == 3);
+    CHECK(dst[2] == iMax);
+
+    auto re = slowmath::try_exclusive_scan(policy, gsl::span<std::int32_t const>(src), gsl::span<std::int32_t>(dst));
+    CHECK(re.ec == std::errc::value_too_large);
+    CHECK(re.value == 4);
+    CHECK(dst[3] == iMax);
+
+        // The sum of all elements is not computed by an exclusive scan.
+    src = { 1, 2, 3, iMax };
+    slowmath::exclusive_scan_checked(policy, gsl::span<std::int32_t const>(src), gsl::span<std::int32_t>(dst.data(), src.size()));
+    CHECK(dst[3] == 6);
+    CHECK_THROWS_AS(slowmath::inclusive_scan_checked(policy, gsl::span<std::int32_t const>(src), gsl::span<std::int32_t>(dst.data(), src.size())), std::system_error);
+}
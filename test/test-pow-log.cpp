@@ -97,4 +97,77 @@ TEMPLATE_TEST_CASE("log_floori(), log_ceili()", "[arithmetic]", int)
     }
 }
 
-// TODO: add comprehensive tests for powi()
+TEMPLATE_TEST_CASE("powi() for signed types", "[pow]", std::int8_t, std::int32_t, std::int64_t)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+    static constexpr int numBits = std::numeric_limits<TestType>::digits;
+
+    SECTION("basic correctness")
+    {
+        CHECK(slowmath::powi_checked(TestType(0), 0) == 1);
+        CHECK(slowmath::powi_checked(TestType(0), 3) == 0);
+        CHECK(slowmath::powi_checked(TestType(3), 0) == 1);
+        CHECK(slowmath::powi_checked(TestType(3), 4) == 81);
+        CHECK(slowmath::powi_checked(TestType(-3), 3) == -27);
+        CHECK(slowmath::powi_checked(TestType(-3), 4) == 81);
+        CHECK(slowmath::try_powi(TestType(-2), 5).value == -32);
+    }
+
+    SECTION("borderline values")
+    {
+        CHECK(slowmath::powi_checked(TestType(2), numBits - 1) == TestType(iMax / 2 + 1));
+        CHECK(slowmath::powi_checked(TestType(-2), numBits) == iMin);
+        CHECK(slowmath::powi_checked(iMax, 1) == iMax);
+        CHECK(slowmath::powi_checked(iMin, 1) == iMin);
+    }
+
+    SECTION("throws on integer overflow")
+    {
+        CHECK_THROWS_AS(slowmath::powi_checked(TestType(2), numBits), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(TestType(-2), numBits + 1), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(iMax, 2), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(iMin, 2), std::system_error);
+        CHECK(slowmath::try_powi(TestType(3), numBits).ec == std::errc::value_too_large);
+        CHECK(slowmath::try_powi(TestType(-3), numBits).ec == std::errc::value_too_large);
+    }
+
+    SECTION("saturates on integer overflow")
+    {
+        CHECK(slowmath::powi_saturating(TestType(2), numBits - 1) == TestType(iMax / 2 + 1));
+        CHECK(slowmath::powi_saturating(TestType(2), numBits) == iMax);
+        CHECK(slowmath::powi_saturating(TestType(-2), numBits) == iMin);
+        CHECK(slowmath::powi_saturating(TestType(-2), numBits + 1) == iMax);
+        CHECK(slowmath::powi_saturating(TestType(-2), numBits + 2) == iMin);
+        CHECK(slowmath::powi_saturating(TestType(-3), numBits) == (numBits % 2 != 0 ? iMin : iMax));
+        CHECK(slowmath::powi_saturating(iMin, 2) == iMax);
+        CHECK(slowmath::powi_saturating(iMin, 3) == iMin);
+    }
+}
+
+TEMPLATE_TEST_CASE("powi() for unsigned types", "[pow]", std::uint8_t, std::uint32_t, std::uint64_t)
+{
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+    static constexpr int numBits = std::numeric_limits<TestType>::digits;
+
+    SECTION("borderline values")
+    {
+        CHECK(slowmath::powi_checked(TestType(2), numBits - 1) == TestType(iMax / 2 + 1));
+        CHECK(slowmath::powi_checked(iMax, 1) == iMax);
+        CHECK(slowmath::powi_checked(TestType(15), 2) == 225);
+    }
+
+    SECTION("throws on integer overflow")
+    {
+        CHECK_THROWS_AS(slowmath::powi_checked(TestType(2), numBits), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(iMax, 2), std::system_error);
+        CHECK_THROWS_AS(slowmath::powi_checked(TestType(16), 2 * sizeof(TestType)), std::system_error);
+    }
+
+    SECTION("saturates on integer overflow")
+    {
+        CHECK(slowmath::powi_saturating(TestType(2), numBits) == iMax);
+        CHECK(slowmath::powi_saturating(iMax, 2) == iMax);
+        CHECK(slowmath::powi_saturating(TestType(15), 2) == 225);
+    }
+}
@@ -1,5 +1,10 @@
 
+#include <cmath>
 #include <tuple>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <system_error>
 
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -14,10 +19,9 @@ TEMPLATE_TEST_CASE("floori(), ceili(), ratio_floori(), ratio_ceili() for signed
     {
         using Tuple = std::tuple<TestType, TestType>;
         auto n_d = GENERATE(
-            Tuple{ -1,  1 },
             Tuple{  1, -1 },
-            Tuple{ -2,  1 },
-            Tuple{ -2, -2 }
+            Tuple{ -2, -2 },
+            Tuple{  0, -3 }
         );
         TestType n, d;
         std::tie(n, d) = n_d;
@@ -27,10 +31,73 @@ TEMPLATE_TEST_CASE("floori(), ceili(), ratio_floori(), ratio_ceili() for signed
 
         CHECK_THROWS(slowmath::floori(n, d));
         CHECK_THROWS(slowmath::ceili_checked(n, d));
-        CHECK_THROWS(slowmath::ratio_floori(n, d));
-        CHECK_THROWS(slowmath::ratio_ceili(n, d));
+        CHECK_NOTHROW(slowmath::ratio_floori(n, d));
+        CHECK_NOTHROW(slowmath::ratio_ceili(n, d));
+        CHECK_NOTHROW(slowmath::modulo_euclid(n, d));
+    }
+
+    SECTION("basic correctness")
+    {
+        CHECK(slowmath::ratio_floori(-7, 2) == -4);
+        CHECK(slowmath::ratio_ceili(-7, 2) == -3);
+        CHECK(slowmath::ratio_floori(7, -2) == -4);
+        CHECK(slowmath::ratio_ceili(7, -2) == -3);
+        CHECK(slowmath::ratio_floori(-7, -2) == 3);
+        CHECK(slowmath::ratio_ceili(-7, -2) == 4);
+        CHECK(slowmath::floori(-7, 2) == -8);
+        CHECK(slowmath::ceili(-7, 2) == -6);
+        CHECK(slowmath::modulo_euclid(-7, 2) == 1);
+        CHECK(slowmath::modulo_euclid(-7, -2) == 1);
+        CHECK(slowmath::modulo_euclid(7, -2) == 1);
+    }
+}
+
+TEMPLATE_TEST_CASE("floori(), ceili(), ratio_floori(), ratio_ceili(), modulo_euclid() for all signs", "[round]", std::int8_t)
+{
+    static constexpr int iMin = std::numeric_limits<TestType>::min();
+    static constexpr int iMax = std::numeric_limits<TestType>::max();
+
+    auto n = GENERATE(range(iMin, iMax + 1, 3));
+    auto d = GENERATE(iMin, iMin + 1, -65, -8, -7, -3, -2, -1, 1, 2, 3, 7, 8, 65, iMax - 1, iMax);
+
+    CAPTURE(n);
+    CAPTURE(d);
+
+        // reference implementation with floating-point arithmetic, which is exact for these operands
+    int floor = int(std::floor(double(n) / d));
+    int ceil = int(std::ceil(double(n) / d));
+    int mod = n - floor*d;
+    if (mod < 0) mod -= d;
+
+    auto rfloor = slowmath::try_ratio_floori(TestType(n), TestType(d));
+    auto rceil = slowmath::try_ratio_ceili(TestType(n), TestType(d));
+    CHECK((rfloor.ec == std::errc{ }) == (floor <= iMax));
+    CHECK((rceil.ec == std::errc{ }) == (ceil <= iMax));
+    if (rfloor.ec == std::errc{ }) CHECK(rfloor.value == floor);
+    if (rceil.ec == std::errc{ }) CHECK(rceil.value == ceil);
+    CHECK(slowmath::modulo_euclid(TestType(n), TestType(d)) == mod);
+
+    if (d > 0)
+    {
+        auto xfloor = slowmath::try_floori(TestType(n), TestType(d));
+        auto xceil = slowmath::try_ceili(TestType(n), TestType(d));
+        CHECK((xfloor.ec == std::errc{ }) == (floor*d >= iMin));
+        CHECK((xceil.ec == std::errc{ }) == (ceil*d <= iMax));
+        if (xfloor.ec == std::errc{ }) CHECK(xfloor.value == floor*d);
+        else CHECK(slowmath::floori_saturating(TestType(n), TestType(d)) == iMin);
+        if (xceil.ec == std::errc{ }) CHECK(xceil.value == ceil*d);
+        else CHECK(slowmath::ceili_saturating(TestType(n), TestType(d)) == iMax);
     }
 
+    if (d != -1)
+    {
+        auto dv = slowmath::divider<TestType>(TestType(d));
+        if (rfloor.ec == std::errc{ }) CHECK(slowmath::ratio_floori(TestType(n), dv) == floor);
+        if (rceil.ec == std::errc{ }) CHECK(slowmath::ratio_ceili(TestType(n), dv) == ceil);
+        CHECK(slowmath::modulo_euclid(TestType(n), dv) == mod);
+        if (d > 0 && floor*d >= iMin) CHECK(slowmath::floori(TestType(n), dv) == floor*d);
+        if (d > 0 && ceil*d <= iMax) CHECK(slowmath::ceili(TestType(n), dv) == ceil*d);
+    }
 }
 
 TEMPLATE_TEST_CASE("floori(), ceili(), ratio_floori(), ratio_ceili()", "[round]", unsigned, int)
@@ -84,4 +151,147 @@ TEMPLATE_TEST_CASE("floori(), ceili(), ratio_floori(), ratio_ceili()", "[round]"
         static_assert(iMax % 2 != 0, "iMax must be odd in a two's complement representation");
         CHECK_THROWS(slowmath::ceili_checked(iMax, TestType(2)));
     }
+
+    SECTION("saturates on integer overflow")
+    {
+        CHECK(slowmath::ceili_saturating(iMax - 1, TestType(2)) == iMax - 1);
+        CHECK(slowmath::ceili_saturating(iMax, TestType(2)) == iMax);
+        CHECK(slowmath::ceili_saturating(iMax - 3, TestType(8)) == iMax);
+        CHECK(slowmath::ceili_saturating(iMax, std::integral_constant<TestType, 4>{ }) == iMax);
+    }
+}
+
+TEMPLATE_TEST_CASE("floori(), ceili(), ratio_floori(), ratio_ceili() with power-of-two constant divisors", "[round]", unsigned, int)
+{
+    static constexpr auto iMin = std::numeric_limits<TestType>::min();
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto check = [](TestType n, auto d)
+    {
+        CAPTURE(n);
+        CAPTURE(TestType(d));
+
+        CHECK(slowmath::floori(n, d) == slowmath::floori(n, TestType(d)));
+        CHECK(slowmath::ratio_floori(n, d) == slowmath::ratio_floori(n, TestType(d)));
+        CHECK(slowmath::ratio_ceili(n, d) == slowmath::ratio_ceili(n, TestType(d)));
+        CHECK(slowmath::modulo_euclid(n, d) == slowmath::modulo_euclid(n, TestType(d)));
+        auto r1 = slowmath::try_ceili(n, d);
+        auto r2 = slowmath::try_ceili(n, TestType(d));
+        CHECK(r1.ec == r2.ec);
+        if (r1.ec == std::errc{ }) CHECK(r1.value == r2.value);
+    };
+    for (TestType n : { iMin, TestType(iMin + 1), TestType(iMin + 8), TestType(-65), TestType(-64), TestType(-63), TestType(-9), TestType(-8), TestType(-7), TestType(-1),
+        TestType(0), TestType(1), TestType(7), TestType(8), TestType(9), TestType(63), TestType(64), TestType(65), TestType(iMax - 8), TestType(iMax - 7), TestType(iMax) })
+    {
+        check(n, std::integral_constant<TestType, 1>{ });
+        check(n, std::integral_constant<TestType, 2>{ });
+        check(n, std::integral_constant<TestType, 8>{ });
+        check(n, std::integral_constant<TestType, 64>{ });
+    }
+    static_assert(slowmath::ceili_checked(TestType(9), std::integral_constant<TestType, 8>{ }) == 16, "");
+    static_assert(slowmath::ratio_ceili(TestType(9), std::integral_constant<TestType, 8>{ }) == 2, "");
+    static_assert(slowmath::ratio_floori(-9, std::integral_constant<int, 8>{ }) == -2, "");
+    static_assert(slowmath::floori(-9, std::integral_constant<int, 8>{ }) == -16, "");
+}
+
+TEMPLATE_TEST_CASE("floori(), ceili(), ratio_floori(), ratio_ceili() with divider", "[round]", unsigned, int)
+{
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    SECTION("basic correctness")
+    {
+        auto n = GENERATE(range(TestType(0), TestType(8)));
+        auto d = GENERATE(range(TestType(1), TestType(8)));
+
+        CAPTURE(n);
+        CAPTURE(d);
+
+        auto dv = slowmath::divider<TestType>(d);
+        CHECK(slowmath::floori(n, dv) == slowmath::floori(n, d));
+        CHECK(slowmath::ceili(n, dv) == slowmath::ceili(n, d));
+        CHECK(slowmath::ratio_floori(n, dv) == slowmath::ratio_floori(n, d));
+        CHECK(slowmath::ratio_ceili(n, dv) == slowmath::ratio_ceili(n, d));
+    }
+
+    SECTION("borderline values")
+    {
+        auto d = GENERATE(TestType(1), TestType(2), TestType(3), iMax - 1, iMax);
+
+        CAPTURE(d);
+
+        auto dv = slowmath::divider<TestType>(d);
+        for (TestType n : { TestType(0), TestType(1), iMax - 1, iMax })
+        {
+            CAPTURE(n);
+            CHECK(slowmath::floori(n, dv) == slowmath::floori(n, d));
+            CHECK(slowmath::ratio_floori(n, dv) == slowmath::ratio_floori(n, d));
+            CHECK(slowmath::ratio_ceili(n, dv) == slowmath::ratio_ceili(n, d));
+            auto r = slowmath::try_ceili(n, d);
+            if (r.ec == std::errc{ }) CHECK(slowmath::ceili(n, dv) == r.value);
+        }
+    }
+}
+
+TEST_CASE("floori(), ceili() with divider enforce preconditions", "[round]")
+{
+    auto dv = slowmath::divider<int>(-2);
+    CHECK_THROWS(slowmath::floori(1, dv));
+    CHECK_THROWS(slowmath::ceili(1, dv));
+    CHECK(slowmath::ratio_floori(1, dv) == -1);
+    CHECK(slowmath::ratio_ceili(-1, slowmath::divider<int>(2)) == 0);
+}
+
+TEMPLATE_TEST_CASE("muldiv_floori(), muldiv_ceili()", "[round]", std::int8_t, std::uint8_t, std::uint16_t)
+{
+    static constexpr auto iMax = std::numeric_limits<TestType>::max();
+
+    auto a = GENERATE(range(0, int(iMax) + 1, int(iMax) / 37 + 1));
+    auto b = GENERATE(0, 1, 2, 3, int(iMax) / 2, int(iMax) - 1, int(iMax));
+    auto d = GENERATE(1, 2, 3, 7, int(iMax) / 3, int(iMax));
+
+    CAPTURE(a);
+    CAPTURE(b);
+    CAPTURE(d);
+
+    long floor = long(a) * b / d;
+    long ceil = (long(a) * b + d - 1) / d;
+    auto rfloor = slowmath::try_muldiv_floori(TestType(a), TestType(b), TestType(d));
+    auto rceil = slowmath::try_muldiv_ceili(TestType(a), TestType(b), TestType(d));
+    CHECK((rfloor.ec == std::errc{ }) == (floor <= long(iMax)));
+    CHECK((rceil.ec == std::errc{ }) == (ceil <= long(iMax)));
+    if (rfloor.ec == std::errc{ }) CHECK(long(rfloor.value) == floor);
+    if (rceil.ec == std::errc{ }) CHECK(long(rceil.value) == ceil);
+}
+
+TEST_CASE("muldiv_floori(), muldiv_ceili() with 64-bit operands", "[round]")
+{
+    static constexpr auto iMax = std::numeric_limits<std::int64_t>::max();
+    static constexpr auto uMax = std::numeric_limits<std::uint64_t>::max();
+
+        // the product overflows, but the result does not
+    CHECK(slowmath::muldiv_floori_checked(uMax, uMax, uMax) == uMax);
+    CHECK(slowmath::muldiv_ceili_checked(uMax, uMax - 1, uMax) == uMax - 1);
+    CHECK(slowmath::muldiv_floori_checked(uMax, std::uint64_t(3), std::uint64_t(4)) == uMax / 4 * 3 + 2);
+    CHECK(slowmath::muldiv_ceili_checked(uMax, std::uint64_t(3), std::uint64_t(4)) == uMax / 4 * 3 + 3);
+    CHECK(slowmath::muldiv_floori_checked(std::uint64_t(1'000'000'007), std::uint64_t(1'000'000'000'000), std::uint64_t(1'000'000'000)) == std::uint64_t(1'000'000'007'000));
+    CHECK(slowmath::muldiv_floori_checked(iMax, iMax, iMax) == iMax);
+    CHECK(slowmath::muldiv_floori_checked(iMax, std::int64_t(2), std::int64_t(3)) == iMax / 3 * 2);
+    CHECK(slowmath::muldiv_ceili_checked(iMax, std::int64_t(2), std::int64_t(3)) == iMax / 3 * 2 + 1);
+    CHECK(slowmath::muldiv_floori(std::int64_t(1) << 40, std::int64_t(1) << 40, std::int64_t(1) << 60) == 1 << 20);
+    CHECK(slowmath::muldiv_ceili_failfast(std::uint64_t(0), uMax, std::uint64_t(7)) == 0);
+
+    CHECK_THROWS_AS(slowmath::muldiv_floori_checked(uMax, std::uint64_t(2), std::uint64_t(1)), std::system_error);
+    CHECK_THROWS_AS(slowmath::muldiv_floori_checked(uMax, uMax, uMax - 1), std::system_error);
+    CHECK(slowmath::muldiv_floori_checked((std::int64_t(1) << 32) + 1, (std::int64_t(1) << 32) - 1, std::int64_t(2)) == iMax);
+    CHECK_THROWS_AS(slowmath::muldiv_ceili_checked((std::int64_t(1) << 32) + 1, (std::int64_t(1) << 32) - 1, std::int64_t(2)), std::system_error);
+    CHECK_THROWS_AS(slowmath::muldiv_floori_checked(iMax, std::int64_t(2), std::int64_t(1)), std::system_error);
+    CHECK_THROWS_AS(slowmath::muldiv_ceili_checked(iMax, iMax, iMax - 1), std::system_error);
+    CHECK(slowmath::try_muldiv_ceili(iMax, std::int64_t(3), std::int64_t(3)).value == iMax);
+    CHECK(slowmath::try_muldiv_ceili(iMax, std::int64_t(4), std::int64_t(3)).ec == std::errc::value_too_large);
+
+    CHECK_THROWS(slowmath::muldiv_floori(std::uint64_t(1), std::uint64_t(1), std::uint64_t(0)));
+
+    static_assert(slowmath::muldiv_floori_checked(uMax, uMax, uMax) == uMax, "");
+    static_assert(slowmath::muldiv_ceili_checked(uMax, std::uint64_t(3), std::uint64_t(4)) == uMax / 4 * 3 + 3, "");
+    static_assert(slowmath::try_muldiv_floori(uMax, uMax, uMax - 1).ec == std::errc::value_too_large, "");
 }
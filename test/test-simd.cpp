@@ -0,0 +1,149 @@
+
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <slowmath/simd.hpp>
+
+
+#if SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD
+
+namespace {
+
+
+namespace stdx = std::experimental;
+
+template <typename T> using fixed_size_simd_5 = stdx::fixed_size_simd<T, 5>;
+
+
+template <typename T>
+constexpr T edgeValues[] = {
+    T(0), T(1), T(2), T(3), T(T(0) - 1), T(T(0) - 2),
+    std::numeric_limits<T>::min(), T(std::numeric_limits<T>::min() + 1),
+    std::numeric_limits<T>::max(), T(std::numeric_limits<T>::max() - 1), T(std::numeric_limits<T>::max() / 2), T(std::numeric_limits<T>::max() / 2 + 1)
+};
+constexpr std::size_t numEdgeValues = 12;
+
+    // Calls `f(a, b)` for vectors a and b whose lanes cover all pairs of edge values.
+template <typename S, typename F>
+void
+for_each_edge_value_pair(F f)
+{
+    using T = typename S::value_type;
+
+    for (std::size_t start = 0; start != numEdgeValues; ++start)
+    {
+        for (std::size_t offset = 0; offset != numEdgeValues; ++offset)
+        {
+            auto a = S([start](auto i) { return edgeValues<T>[(start + i) % numEdgeValues]; });
+            auto b = S([start, offset](auto i) { return edgeValues<T>[(start + offset + i) % numEdgeValues]; });
+            f(a, b);
+        }
+    }
+}
+
+    // Compares the lane-wise results and overflow masks of a `try_` operation on vectors with the results of the scalar
+    // operation.
+template <typename S, typename ScalarR>
+void
+check_try_result(slowmath::simd_arithmetic_result<S> const& r, ScalarR scalarR)
+{
+    for (std::size_t i = 0; i != S::size(); ++i)
+    {
+        auto rs = scalarR(i);
+        CAPTURE(i);
+        CHECK(r.overflow[i] == (rs.ec != std::errc{ }));
+        if (rs.ec == std::errc{ })
+        {
+            CHECK(r.value[i] == rs.value);
+        }
+    }
+}
+
+
+} // anonymous namespace
+
+
+TEMPLATE_PRODUCT_TEST_CASE("operations on simd vectors report overflow for the same lanes as the scalar operations", "[simd]",
+    (stdx::native_simd, fixed_size_simd_5), (std::int8_t, std::uint8_t, std::int16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t))
+{
+    using S = TestType;
+    using T = typename S::value_type;
+
+    for_each_edge_value_pair<S>([](S a, S b)
+    {
+        CAPTURE(a[0], b[0]);
+
+        check_try_result(slowmath::try_absi(a), [&](std::size_t i) { return slowmath::try_absi(T(a[i])); });
+        check_try_result(slowmath::try_negate(a), [&](std::size_t i) { return slowmath::try_negate(T(a[i])); });
+        check_try_result(slowmath::try_square(a), [&](std::size_t i) { return slowmath::try_square(T(a[i])); });
+        check_try_result(slowmath::try_add(a, b), [&](std::size_t i) { return slowmath::try_add(T(a[i]), T(b[i])); });
+        check_try_result(slowmath::try_subtract(a, b), [&](std::size_t i) { return slowmath::try_subtract(T(a[i]), T(b[i])); });
+        check_try_result(slowmath::try_multiply(a, b), [&](std::size_t i) { return slowmath::try_multiply(T(a[i]), T(b[i])); });
+
+        auto ax = S([&](auto i) { return a[i] < 0 ? T(0) : a[i]; });
+        auto sb = S([&](auto i) { return T(std::size_t(b[i]) % (sizeof(T) * 8 + 2)); });
+        check_try_result(slowmath::try_shift_left(ax, sb), [&](std::size_t i) { return slowmath::try_shift_left(T(ax[i]), T(sb[i])); });
+        check_try_result(slowmath::try_shift_left(ax, 3), [&](std::size_t i) { return slowmath::try_shift_left(T(ax[i]), 3); });
+
+        auto db = S([&](auto i) { return b[i] <= 0 ? T(1) : b[i]; });
+        check_try_result(slowmath::try_ceili(a, db), [&](std::size_t i) { return slowmath::try_ceili(T(a[i]), T(db[i])); });
+        check_try_result(slowmath::try_ceili(a, T(3)), [&](std::size_t i) { return slowmath::try_ceili(T(a[i]), T(3)); });
+
+        auto sum = slowmath::add_saturating(a, b);
+        auto difference = slowmath::subtract_saturating(a, b);
+        auto product = slowmath::multiply_saturating(a, b);
+        auto shifted = slowmath::shift_left_saturating(ax, sb);
+        auto rounded = slowmath::ceili_saturating(a, db);
+        for (std::size_t i = 0; i != S::size(); ++i)
+        {
+            CHECK(sum[i] == slowmath::add_saturating(T(a[i]), T(b[i])));
+            CHECK(difference[i] == slowmath::subtract_saturating(T(a[i]), T(b[i])));
+            CHECK(product[i] == slowmath::multiply_saturating(T(a[i]), T(b[i])));
+            CHECK(shifted[i] == slowmath::shift_left_saturating(T(ax[i]), T(sb[i])));
+            CHECK(rounded[i] == slowmath::ceili_saturating(T(a[i]), T(db[i])));
+        }
+    });
+}
+
+TEMPLATE_TEST_CASE("error handlers check all lanes of simd vectors at once", "[simd]", std::int32_t, std::uint64_t)
+{
+    using S = stdx::native_simd<TestType>;
+    using T = TestType;
+
+    constexpr T tMax = std::numeric_limits<T>::max();
+
+    auto a = S([](auto i) { return T(i); });
+    auto b = S([](auto i) { return i == S::size() - 1 ? tMax : T(1); });
+
+    auto r0 = slowmath::add_checked(a, S(T(1)));
+    CHECK(stdx::all_of(r0 == a + 1));
+    CHECK(stdx::all_of(slowmath::multiply_failfast(a, S(T(2))) == a + a));
+    CHECK(stdx::all_of(slowmath::shift_left_checked(a, 1) == a + a));
+    CHECK(stdx::all_of(slowmath::ceili_checked(a, T(4)) == ((a + 3) / 4) * 4));
+
+    auto r1 = slowmath::add<slowmath::try_error_handler>(a, S(T(1)));
+    CHECK(r1.ec == std::errc{ });
+    CHECK(stdx::all_of(r1.value == a + 1));
+    auto r2 = slowmath::add<slowmath::try_error_handler>(a, b);
+    CHECK(r2.ec == std::errc::value_too_large);
+
+    auto r3 = slowmath::try_add(a, b);
+    CHECK(stdx::popcount(r3.overflow) == (S::size() > 1 ? 1 : 0));
+    CHECK(stdx::all_of(r3.overflow == (a != 0 && b == tMax)));
+
+    if (S::size() > 1)
+    {
+        CHECK_THROWS_AS(slowmath::add_checked(a, b), std::system_error);
+        CHECK_THROWS_AS(slowmath::add<slowmath::throw_error_handler>(a, b), std::system_error);
+        CHECK_THROWS_AS(slowmath::shift_left_checked(S(tMax), S([](auto i) { return T(i == 0 ? 0 : 1); })), std::system_error);
+    }
+    CHECK_THROWS_AS(slowmath::square_checked(S(tMax)), std::system_error);
+    CHECK_THROWS_AS(slowmath::ceili_checked(S(tMax), T(2)), std::system_error);
+}
+
+#endif // SLOWMATH_DETAIL_HAVE_EXPERIMENTAL_SIMD
@@ -0,0 +1,190 @@
+
+    // Instrument the `try_*()` and `*_checked()` operations.
+#define SLOWMATH_OVERFLOW_TELEMETRY 1
+
+
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <sstream>
+#include <system_error>
+
+#include <gsl-lite/gsl-lite.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <slowmath/arithmetic.hpp>
+#include <slowmath/telemetry.hpp>
+
+
+namespace {
+
+
+std::uint64_t
+total_overflow_count()
+{
+    auto telemetry = slowmath::get_overflow_telemetry();
+    std::uint64_t result = telemetry.dropped;
+    for (auto const& r : telemetry.records)
+    {
+        result += r.count;
+    }
+    return result;
+}
+
+std::uint64_t
+overflow_count_at(unsigned line)
+{
+    auto telemetry = slowmath::get_overflow_telemetry();
+    std::uint64_t result = 0;
+    for (auto const& r : telemetry.records)
+    {
+        if (r.line == line && r.file != nullptr && std::strcmp(r.file, __FILE__) == 0) result += r.count;
+    }
+    return result;
+}
+
+
+} // anonymous namespace
+
+
+TEST_CASE("telemetry_error_handler<>", "[telemetry]")
+{
+    SLOWMATH_CALL_SITE(testMultiply);
+    using try_telemetry = slowmath::telemetry_error_handler<slowmath::try_error_handler>;
+    using try_multiply_telemetry = slowmath::telemetry_error_handler<slowmath::try_error_handler, testMultiply>;
+    using throw_telemetry = slowmath::telemetry_error_handler<slowmath::throw_error_handler>;
+
+    static constexpr auto iMax = std::numeric_limits<std::int32_t>::max();
+
+    auto count0 = total_overflow_count();
+
+    CHECK(slowmath::add<try_telemetry>(std::int32_t(1), std::int32_t(2)).value == 3);
+    CHECK(slowmath::powi<throw_telemetry>(std::int32_t(3), 3) == 27);
+    CHECK(total_overflow_count() == count0);
+
+    for (int i = 0; i != 3; ++i)
+    {
+        CHECK(slowmath::multiply<try_telemetry>(iMax, std::int32_t(2)).ec == std::errc::value_too_large);
+    }
+    CHECK_THROWS_AS(slowmath::powi<throw_telemetry>(iMax, 2), slowmath::overflow_error);
+    CHECK(slowmath::powi<try_telemetry>(std::int32_t(-2), 31).value == std::numeric_limits<std::int32_t>::min());
+    CHECK(total_overflow_count() == count0 + 4);
+
+    CHECK(slowmath::multiply<try_multiply_telemetry>(iMax, std::int32_t(2)).ec == std::errc::value_too_large);
+    CHECK(overflow_count_at(testMultiply::line()) == 1);
+
+    auto telemetry = slowmath::get_overflow_telemetry();
+    REQUIRE(!telemetry.records.empty());
+    CHECK(telemetry.records.front().count >= 3);
+
+    auto text = std::ostringstream{ };
+    slowmath::write_overflow_telemetry(text, telemetry);
+    CHECK(text.str().find("overflow(s) at") != std::string::npos);
+
+    auto json = std::ostringstream{ };
+    slowmath::write_overflow_telemetry(json, telemetry, slowmath::telemetry_format::json);
+    CHECK(json.str().find("\"records\": [") != std::string::npos);
+    CHECK(json.str().find("\"dropped\": ") != std::string::npos);
+}
+
+TEST_CASE("headroom_error_handler<>", "[telemetry]")
+{
+    SLOWMATH_HEADROOM_SITE(testRowBytes);
+    SLOWMATH_HEADROOM_SITE(testOffset);
+    using row_bytes_profiler = slowmath::headroom_error_handler<slowmath::throw_error_handler, testRowBytes, slowmath::arithmetic_operation::multiply>;
+    using offset_profiler = slowmath::headroom_error_handler<slowmath::try_error_handler, testOffset>;
+
+    for (std::int64_t i = 0; i != 1000; ++i)
+    {
+        CHECK(slowmath::multiply<row_bytes_profiler>(i, std::int64_t(300)) == i*300);
+    }
+    CHECK(slowmath::subtract<offset_profiler>(std::int16_t(-100), std::int16_t(28)).value == -128);
+    CHECK(slowmath::add<offset_profiler>(std::uint8_t(1), std::uint8_t(2)).value == 3);
+    CHECK(slowmath::add<offset_profiler>(std::uint64_t(0), std::uint64_t(0)).value == 0);
+    CHECK(slowmath::add<offset_profiler>(std::uint64_t(1) << 63, std::uint64_t(1) << 62).value == std::uint64_t(3) << 62);
+    CHECK(slowmath::subtract<offset_profiler>(std::int32_t(-1), std::int32_t(0)).value == -1);
+
+    auto profile = slowmath::get_headroom_profile();
+    auto find = [&profile](char const* site, unsigned typeBits)
+    {
+        auto it = std::find_if(profile.begin(), profile.end(),
+            [site, typeBits](slowmath::headroom_record const& r)
+            {
+                return std::strcmp(r.site, site) == 0 && r.typeBits == typeBits;
+            });
+        REQUIRE(it != profile.end());
+        return *it;
+    };
+    auto rowBytes = find("testRowBytes", 64);
+    CHECK(rowBytes.isSigned);
+    CHECK(rowBytes.maxBits == 20);  // 999 ∙ 300 = 299700 < 2¹⁹
+    CHECK(rowBytes.operation == slowmath::arithmetic_operation::multiply);
+    CHECK(find("testOffset", 16).operation == slowmath::arithmetic_operation::unspecified);
+    CHECK(find("testOffset", 16).maxBits == 8);
+    CHECK(find("testOffset", 8).maxBits == 2);
+    CHECK(!find("testOffset", 8).isSigned);
+    CHECK(find("testOffset", 64).maxBits == 64);
+    CHECK(find("testOffset", 32).maxBits == 1);
+
+    auto text = std::ostringstream{ };
+    slowmath::write_headroom_profile(text, profile);
+    CHECK(text.str().find("testRowBytes") != std::string::npos);
+    CHECK(text.str().find("multiply(), int64 results never used more than 20 bits") != std::string::npos);
+    CHECK(text.str().find("): int16 results never used more than 8 bits") != std::string::npos);
+
+    auto json = std::ostringstream{ };
+    slowmath::write_headroom_profile(json, profile, slowmath::telemetry_format::json);
+    CHECK(json.str().find("\"operation\": \"multiply\", \"type\": \"int64\", \"max_bits\": 20") != std::string::npos);
+}
+
+TEST_CASE("SLOWMATH_OVERFLOW_TELEMETRY instruments the try_*() and *_checked() operations", "[telemetry]")
+{
+    static constexpr auto iMax = std::numeric_limits<std::int32_t>::max();
+
+    auto count0 = total_overflow_count();
+
+    CHECK(slowmath::try_add(std::int32_t(1), std::int32_t(2)).value == 3);
+    CHECK(slowmath::multiply_checked(std::int32_t(3), std::int32_t(4)) == 12);
+    CHECK(total_overflow_count() == count0);
+
+    unsigned tryLine = __LINE__; CHECK(slowmath::try_add(iMax, std::int32_t(1)).ec == std::errc::value_too_large);
+    CHECK(overflow_count_at(tryLine) == 1);
+
+    unsigned checkedLine = __LINE__; CHECK_THROWS_AS(slowmath::multiply_checked(iMax, std::int32_t(2)), slowmath::overflow_error);
+    CHECK(overflow_count_at(checkedLine) == 1);
+
+    unsigned divideLine = __LINE__; CHECK_THROWS_AS(slowmath::divide_checked(std::numeric_limits<std::int32_t>::min(), std::int32_t(-1)), slowmath::overflow_error);
+    CHECK(overflow_count_at(divideLine) == 1);
+
+    auto v = std::vector<std::int32_t>{ 1, iMax };
+    auto cv = gsl::span<std::int32_t const>(v);
+    unsigned sumLine = __LINE__; CHECK_THROWS_AS(slowmath::sum_checked(cv), slowmath::overflow_error);
+    CHECK(overflow_count_at(sumLine) == 1);
+
+    auto dst = std::vector<std::int32_t>(v.size());
+    unsigned scanLine = __LINE__; CHECK(slowmath::try_inclusive_scan(cv, gsl::span<std::int32_t>(dst)).value == 1);
+    CHECK(overflow_count_at(scanLine) == 1);
+    unsigned addLine = __LINE__; CHECK_THROWS_AS(slowmath::add_checked(cv, cv, gsl::span<std::int32_t>(dst)), slowmath::overflow_error);
+    CHECK(overflow_count_at(addLine) == 1);
+
+    CHECK(total_overflow_count() == count0 + 6);
+}
+
+TEST_CASE("writing telemetry to a file reports I/O errors", "[telemetry]")
+{
+    auto telemetry = slowmath::get_overflow_telemetry();
+    try
+    {
+        slowmath::write_overflow_telemetry("/nonexistent-directory/telemetry.txt", telemetry);
+        FAIL("no exception thrown");
+    }
+    catch (std::system_error const& e)
+    {
+        CHECK(e.code() == std::errc::io_error);
+    }
+    CHECK_THROWS_AS(slowmath::write_headroom_profile("/nonexistent-directory/headroom.txt", slowmath::get_headroom_profile()), std::system_error);
+}